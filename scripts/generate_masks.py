@@ -156,6 +156,59 @@ def get_non_slider_attack_mask(rank, file, non_slider_moves):
     return get_bitboard(non_slider_board)
 
 
+def get_ray_dir(rank, file, other_rank, other_file):
+    """Gets the single move direction leading from one square to another.
+
+    Returns None if the squares are equal or don't share a rank, file,
+    diagonal or anti-diagonal.
+    """
+    rank_diff = other_rank - rank
+    file_diff = other_file - file
+    if rank_diff == 0 and file_diff == 0:
+        return None
+    if (rank_diff != 0 and file_diff != 0
+            and abs(rank_diff) != abs(file_diff)):
+        return None
+    return ((rank_diff > 0) - (rank_diff < 0),
+            (file_diff > 0) - (file_diff < 0))
+
+
+def get_between_mask(rank, file, other_sq):
+    """Computes the squares strictly between two squares on a shared line.
+
+    The mask is empty for squares that aren't aligned.
+    """
+    between_board = [[0 for file in range(__NUM_FILES)] for rank in
+                     range(__NUM_RANKS)]
+    other_rank = other_sq // __NUM_FILES
+    other_file = other_sq % __NUM_FILES
+    ray_dir = get_ray_dir(rank, file, other_rank, other_file)
+    if ray_dir is not None:
+        move_rank = rank + ray_dir[0]
+        move_file = file + ray_dir[1]
+        while move_rank != other_rank or move_file != other_file:
+            between_board[move_rank][move_file] = 1
+            move_rank += ray_dir[0]
+            move_file += ray_dir[1]
+    return get_bitboard(between_board)
+
+
+def get_line_mask(rank, file, other_sq):
+    """Computes the full line through two aligned squares, edge to edge.
+
+    The mask includes both squares, and is empty for squares that aren't
+    aligned.
+    """
+    other_rank = other_sq // __NUM_FILES
+    other_file = other_sq % __NUM_FILES
+    ray_dir = get_ray_dir(rank, file, other_rank, other_file)
+    if ray_dir is None:
+        return 0
+    opposite_dir = (-ray_dir[0], -ray_dir[1])
+    return (get_slider_piece_mask(rank, file, [ray_dir, opposite_dir], True)
+            | (1 << (__NUM_FILES * rank + file)))
+
+
 def format_hex(hex_num, num_digits):
     """Formats hex numbers with set number of digits and upper case letters"""
     return "{0:#0{1}X}".format(hex_num, num_digits + 2)
@@ -180,6 +233,29 @@ def write_mask_set(f, mask_name, mask_generator, args):
                 f.write(", ")
 
 
+def write_sq_pair_mask_sets(f, mask_name, mask_generator):
+    """Lays out a mask set for every first square of a square pair
+
+    The mask name is formatted with the name of the first square.
+    """
+    f.write("{")
+    for sq in range(__NUM_RANKS * __NUM_FILES):
+        sq_name = chr(ord('a') + sq % __NUM_FILES) + str(sq // __NUM_FILES + 1)
+        write_mask_set(f, mask_name.format(sq_name), mask_generator, [sq])
+        if sq != __NUM_RANKS * __NUM_FILES - 1:
+            f.write(",")
+    f.write("\n};")
+
+
+def get_sq_pair_mask_generator(mask_generator):
+    """Adapts a square pair mask generator to iterate over second squares"""
+    def generate_mask(rank, file, first_sq):
+        return mask_generator(first_sq // __NUM_FILES,
+                              first_sq % __NUM_FILES,
+                              __NUM_FILES * rank + file)
+    return generate_mask
+
+
 if __name__ == "__main__":
     # Write bitboards representing piece masks to a C++ file "masks.cc"
     boiler_plate = ("/* Noah Himed" + "\n*"
@@ -261,5 +337,19 @@ if __name__ == "__main__":
                    get_pawn_front_span_mask, ["BLACK"])
     f.write("\n};")
 
+    f.write("\n\nconst Bitboard kQueenRayMasks[kNumSq] =")
+    queen_moves = bishop_moves + rook_moves
+    write_mask_set(f, "queen ray masks",
+                   get_slider_piece_mask, [queen_moves, True])
+    f.write(";")
+
+    f.write("\n\nconst Bitboard kBetweenMasks[kNumSq][kNumSq] = ")
+    write_sq_pair_mask_sets(f, "masks of squares between {} and each square",
+                            get_sq_pair_mask_generator(get_between_mask))
+
+    f.write("\n\nconst Bitboard kLineMasks[kNumSq][kNumSq] = ")
+    write_sq_pair_mask_sets(f, "masks of lines through {} and each square",
+                            get_sq_pair_mask_generator(get_line_mask))
+
     f.write("\n\n} // namespace omegazero\n")
     f.close()
@@ -0,0 +1,223 @@
+/* Noah Himed
+ *
+ * Implement the batch EPD analysis mode.
+ *
+ * Licensed under MIT License. Terms and conditions enclosed in "LICENSE.txt".
+ */
+
+#include "analysis.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "board.h"
+#include "engine.h"
+#include "game.h"
+#include "move.h"
+
+namespace omegazero {
+
+using std::atomic;
+using std::cerr;
+using std::cout;
+using std::cref;
+using std::endl;
+using std::exception;
+using std::ifstream;
+using std::invalid_argument;
+using std::istringstream;
+using std::lock_guard;
+using std::mutex;
+using std::ostringstream;
+using std::ref;
+using std::streampos;
+using std::string;
+using std::thread;
+using std::vector;
+using std::chrono::duration;
+using std::chrono::duration_cast;
+using std::chrono::high_resolution_clock;
+
+namespace {
+
+struct EpdPos {
+  string fen;
+  string id;
+};
+
+// Parse an EPD record into a FEN string and the value of its "id" operation,
+// returning false for blank lines. EPD records store the first four FEN fields
+// followed by operations (ex: bm Nf3; id "WAC.001";), so the halfmove clock and
+// fullmove number are only taken from the record if it's a full FEN string.
+auto ParseEpdLine(const string& epd_line, EpdPos& epd_pos) -> bool {
+  istringstream epd_stream(epd_line);
+  constexpr int kNumEpdFields = 4;
+  string field;
+  epd_pos.fen.clear();
+  epd_pos.id.clear();
+  for (int field_idx = 0; field_idx < kNumEpdFields; ++field_idx) {
+    if (!(epd_stream >> field)) {
+      if (field_idx == 0) {
+        return false;
+      }
+      throw invalid_argument("EPD record \"" + epd_line + "\"");
+    }
+    epd_pos.fen += (field_idx == 0) ? field : " " + field;
+  }
+
+  string halfmove_clock;
+  string fullmove_num;
+  streampos operations_pos = epd_stream.tellg();
+  if (epd_stream >> halfmove_clock >> fullmove_num &&
+      halfmove_clock.find_first_not_of("0123456789") == string::npos &&
+      fullmove_num.find_first_not_of("0123456789") == string::npos) {
+    epd_pos.fen += " " + halfmove_clock + " " + fullmove_num;
+  } else {
+    epd_pos.fen += " 0 1";
+    epd_stream.clear();
+    epd_stream.seekg(operations_pos);
+  }
+
+  // Find the position's id among the remaining operations.
+  string operations;
+  getline(epd_stream, operations);
+  size_t id_idx = operations.find("id \"");
+  if (id_idx != string::npos) {
+    size_t id_start_idx = id_idx + 4;
+    size_t id_end_idx = operations.find('"', id_start_idx);
+    epd_pos.id = operations.substr(id_start_idx, id_end_idx - id_start_idx);
+  }
+  return true;
+}
+
+// Escape quotes and backslashes so a string can be written as a JSON value.
+auto EscapeJsonStr(const string& str) -> string {
+  string escaped_str;
+  for (char ch : str) {
+    if (ch == '"' || ch == '\\') {
+      escaped_str += '\\';
+    }
+    escaped_str += ch;
+  }
+  return escaped_str;
+}
+
+// Search positions until none are left, taking the next unsearched position
+// from the shared index each time.
+auto AnalyzePositions(const vector<EpdPos>& epd_positions,
+                      atomic<size_t>& next_pos_idx, float search_time,
+                      const SearchOptions& search_options,
+                      mutex& output_mutex) -> void {
+  Board board("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
+  Engine engine(&board, 'w', search_time, search_options);
+  size_t num_positions = epd_positions.size();
+  for (size_t pos_idx = next_pos_idx++; pos_idx < num_positions;
+       pos_idx = next_pos_idx++) {
+    const EpdPos& epd_pos = epd_positions[pos_idx];
+    ostringstream result;
+    result << "{\"index\":" << pos_idx << ",\"id\":\""
+           << EscapeJsonStr(epd_pos.id) << "\",\"fen\":\""
+           << EscapeJsonStr(epd_pos.fen) << "\"";
+    try {
+      board.SetPos(epd_pos.fen);
+      engine.NewPosition();
+      S8 player_to_move = board.GetPlayerToMove();
+
+      high_resolution_clock::time_point search_start =
+          high_resolution_clock::now();
+      Move best_move = engine.GetBestMove();
+      float search_duration = duration_cast<duration<float>>(
+                                  high_resolution_clock::now() - search_start)
+                                  .count();
+
+      // Report a null best move for positions without legal moves.
+      result << ",\"bestmove\":";
+      if (best_move.moving_piece == kNA && best_move.castling_type == kNA) {
+        result << "null";
+      } else {
+        result << "\"" << GetUciMoveStr(best_move, player_to_move) << "\"";
+      }
+      result << ",\"pv\":[";
+      S8 moving_player = player_to_move;
+      const vector<Move>& principal_variation = engine.GetPrincipalVariation();
+      for (size_t move_idx = 0; move_idx < principal_variation.size();
+           ++move_idx) {
+        result << (move_idx > 0 ? ",\"" : "\"")
+               << GetUciMoveStr(principal_variation[move_idx], moving_player)
+               << "\"";
+        moving_player = GetOtherPlayer(moving_player);
+      }
+      result << "],\"score\":" << engine.GetSearchEval()
+             << ",\"depth\":" << engine.GetSearchDepth()
+             << ",\"nodes\":" << engine.GetNodeCount() << ",\"time_ms\":"
+             << static_cast<U64>(search_duration * 1000.0f) << "}";
+    } catch (exception& e) {
+      result << ",\"error\":\"" << EscapeJsonStr(e.what()) << "\"}";
+    }
+
+    lock_guard<mutex> output_lock(output_mutex);
+    cout << result.str() << endl;
+  }
+}
+
+}  // namespace
+
+auto RunEpdAnalysis(const string& epd_path, int num_threads, float search_time,
+                    SearchOptions search_options) -> void {
+  if (num_threads < 1) {
+    throw invalid_argument("Number of threads must be at least one");
+  }
+
+  ifstream epd_f(epd_path);
+  if (!epd_f.is_open()) {
+    throw invalid_argument("EPD file can't be opened");
+  }
+  vector<EpdPos> epd_positions;
+  string epd_line;
+  EpdPos epd_pos;
+  while (getline(epd_f, epd_line)) {
+    if (ParseEpdLine(epd_line, epd_pos)) {
+      epd_positions.push_back(epd_pos);
+    }
+  }
+  epd_f.close();
+
+  // Only print the results of each search.
+  search_options.verbose = false;
+  search_options.stats_format = kNoStats;
+  atomic<size_t> next_pos_idx(0);
+  mutex output_mutex;
+  high_resolution_clock::time_point analysis_start =
+      high_resolution_clock::now();
+  vector<thread> workers;
+  workers.reserve(num_threads);
+  for (int thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+    workers.emplace_back(AnalyzePositions, cref(epd_positions),
+                         ref(next_pos_idx), search_time,
+                         cref(search_options), ref(output_mutex));
+  }
+  for (thread& worker : workers) {
+    worker.join();
+  }
+
+  // Write a summary to standard error to keep standard output valid JSONL.
+  float analysis_duration = duration_cast<duration<float>>(
+                                high_resolution_clock::now() - analysis_start)
+                                .count();
+  cerr << "Analyzed " << epd_positions.size() << " positions in "
+       << static_cast<U64>(analysis_duration * 1000.0f) << " ms using "
+       << num_threads << " threads" << endl;
+}
+
+}  // namespace omegazero
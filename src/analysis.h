@@ -0,0 +1,28 @@
+/* Noah Himed
+ *
+ * Define a batch analysis mode, which searches every position in an EPD file
+ * using a pool of worker threads and streams the results as JSON lines.
+ *
+ * Licensed under MIT License. Terms and conditions enclosed in "LICENSE.txt".
+ */
+
+#ifndef OMEGAZERO_SRC_ANALYSIS_H_
+#define OMEGAZERO_SRC_ANALYSIS_H_
+
+#include <string>
+
+#include "engine.h"
+
+namespace omegazero {
+
+// Search each position of an EPD file, spreading the positions across the
+// given number of worker threads. Each worker owns its own Board and Engine,
+// searching with the given search time and the depth and node limits in the
+// search options. One JSON object is written to standard output per position
+// as soon as its search finishes, so results may be out of order.
+auto RunEpdAnalysis(const std::string& epd_path, int num_threads,
+                    float search_time, SearchOptions search_options) -> void;
+
+}  // namespace omegazero
+
+#endif  // OMEGAZERO_SRC_ANALYSIS_H_
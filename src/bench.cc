@@ -0,0 +1,491 @@
+/* Noah Himed
+ *
+ * Implement the fixed-depth search benchmark.
+ *
+ * Licensed under MIT License. Terms and conditions enclosed in "LICENSE.txt".
+ */
+
+#include "bench.h"
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "bad_move.h"
+#include "board.h"
+#include "engine.h"
+#include "eval_params.h"
+#include "move.h"
+#include "perf_counters.h"
+
+namespace omegazero {
+
+using std::cout;
+using std::endl;
+using std::invalid_argument;
+using std::make_unique;
+using std::runtime_error;
+using std::string;
+using std::unique_ptr;
+using std::vector;
+using std::chrono::duration;
+using std::chrono::duration_cast;
+using std::chrono::high_resolution_clock;
+
+const string kBenchPositions[kNumBenchPositions] = {
+    "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 10",
+    "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 11",
+    "4rrk1/pp1n3p/3q2pQ/2p1pb2/2PP4/2P3N1/P2B2PP/4RRK1 b - - 7 19",
+    "rq3rk1/ppp2ppp/1bnpb3/3N2B1/3NP3/7P/PPPQ1PP1/2KR3R w - - 7 14",
+    "r1bq1r1k/1pp1n1pp/1p1p4/4p2Q/4Pp2/1BNP4/PPP2PPP/3R1RK1 w - - 2 14",
+    "r3r1k1/2p2ppp/p1p1bn2/8/1q2P3/2NPQN2/PPP3PP/R4RK1 b - - 2 15",
+    "r1bbk1nr/pp3p1p/2n5/1N4p1/2Np1B2/8/PPP2PPP/2KR1B1R w kq - 0 13",
+    "r1bq1rk1/ppp1nppp/4n3/3p3Q/3P4/1BP1B3/PP1N2PP/R4RK1 w - - 1 16",
+    "4r1k1/r1q2ppp/ppp2n2/4P3/5Rb1/1N1BQ3/PPP3PP/R5K1 w - - 1 17",
+    "2rqkb1r/ppp2p2/2npb1p1/1N1Nn2p/2P1PP2/8/PP2B1PP/R1BQK2R b KQ - 0 11",
+    "r1bq1r1k/b1p1npp1/p2p3p/1p6/3PP3/1B2NN2/PP3PPP/R2Q1RK1 w - - 1 16",
+    "3r1rk1/p5pp/bpp1pp2/8/q1PP1P2/b3P3/P2NQRPP/1R2B1K1 b - - 6 22",
+    "r1q2rk1/2p1bppp/2Pp4/p6b/Q1PNp3/4B3/PP1R1PPP/2K4R w - - 2 18",
+    "4k2r/1pb2ppp/1p2p3/1R1p4/3P4/2r1PN2/P4PPP/1R4K1 b - - 3 22",
+    "3q2k1/pb3p1p/4pbp1/2r5/PpN2N2/1P2P2P/5PP1/Q2R2K1 b - - 4 26",
+    "r3k2r/3nnpbp/q2pp1p1/p7/Pp1PPPP1/4BNN1/1P5P/R2Q1RK1 w kq - 0 16",
+    "rnbqkb1r/pp1p1ppp/4pn2/2pP4/2P5/8/PP2PPPP/RNBQKBNR w KQkq c6 0 4",
+    "rnbqkbnr/ppp1p1pp/8/3pPp2/8/8/PPPP1PPP/RNBQKBNR w KQkq f6 0 3",
+    "r1bqkb1r/pppp1ppp/2n2n2/4p2Q/2B1P3/8/PPPP1PPP/RNB1K1NR w KQkq - 4 4",
+    "6k1/3b3r/1p1p4/p1n2p2/1PPNpP1q/P3Q1p1/1R1RB1P1/5K2 b - - 0 1",
+    "r2r1n2/pp2bk2/2p1p2p/3q4/3PN1QP/2P3R1/P4PP1/5RK1 w - - 0 1",
+    "3Qb1k1/1r2ppb1/pN1n2q1/Pp1Pp1Pr/4P2p/4BP2/4B1R1/1R5K b - - 11 40",
+    "4k3/3q1r2/1N2r1b1/3ppN2/2nPP3/1B1R2n1/2R1Q3/3K4 w - - 5 1",
+    "6k1/6p1/6Pp/ppp5/3pn2P/1P3K2/1PP2P2/3N4 b - - 0 1",
+    "3b4/5kp1/1p1p1p1p/pP1PpP1P/P1P1P3/3KN3/8/8 w - - 0 1",
+    "2K5/p7/7P/5pR1/8/5k2/r7/8 w - - 0 1",
+    "8/6pk/1p6/8/PP3p1p/5P2/4KP1q/3Q4 w - - 0 1",
+    "7k/3p2pp/4q3/8/4Q3/5Kp1/P6b/8 w - - 0 1",
+    "8/2p5/8/2kPKp1p/2p4P/2P5/3P4/8 w - - 0 1",
+    "8/1p3pp1/7p/5P1P/2k3P1/8/2K2P2/8 w - - 0 1",
+    "8/pp2r1k1/2p1p3/3pP2p/1P1P1P1P/P5KR/8/8 w - - 0 1",
+    "8/3p4/p1bk3p/Pp6/1Kp1PpPp/2P2P1P/2P5/5B2 b - - 0 1",
+    "5k2/7R/4P2p/5K2/p1r2P1p/8/8/8 b - - 0 1",
+    "6k1/6p1/P6p/r1N5/5p2/7P/1b3PP1/4R1K1 w - - 0 1",
+    "1r3k2/4q3/2Pp3b/3Bp3/2Q2p2/1p1P2P1/1P2KP2/3N4 w - - 0 1",
+    "8/1P6/8/8/8/8/5k1p/3K4 w - - 0 1",
+    "8/8/1P6/5pr1/8/4R3/7k/2K5 w - - 0 1",
+    "8/8/3P3k/8/1p6/8/1P6/1K3n2 b - - 0 1",
+    "8/8/8/8/8/6k1/6p1/6K1 w - - 0 1",
+};
+
+namespace {
+
+// Compute the material and piece square term of the evaluation by scanning
+// every square, as the evaluation did before it was driven by bitboards.
+auto EvaluatePiecePositionsBySq(const Board& board) -> int {
+  const EvalParams& eval_params = kDefaultEvalParams;
+
+  // Compute phase for tapered evaluation of king position.
+  int phase = kTotalPhase;
+  Bitboard pieces;
+  for (S8 player = kWhite; player <= kBlack; ++player) {
+    for (S8 piece = kPawn; piece <= kQueen; ++piece) {
+      pieces = board.GetPiecesByType(piece, player);
+      phase -= (GetNumSetSq(pieces) * kPiecePhases[piece]);
+    }
+  }
+  phase = (phase * kPhaseNorm + (kTotalPhase / 2)) / kTotalPhase;
+
+  int material_bonus = 0;
+  S8 piece_type;
+  S8 mirror_sq;
+  for (S8 sq = kSqA1; sq <= kSqH8; ++sq) {
+    piece_type = board.GetPieceOnSq(sq);
+    if (piece_type != kNA) {
+      // Count material and add positional bonuses.
+      if (board.GetPlayerOnSq(sq) == kWhite) {
+        // Compute the score contribution of a white piece.
+        if (piece_type == kKing) {
+          // Compute the tapered evalution for the king position.
+          material_bonus += eval_params.piece_vals[kKing];
+          material_bonus +=
+              ((eval_params.piece_sq_tables[kKing][sq] * (kPhaseNorm - phase) +
+                eval_params.endgame_king_piece_sq_table[sq] * phase) /
+               kPhaseNorm);
+        } else {
+          material_bonus += (eval_params.piece_vals[piece_type] +
+                             eval_params.piece_sq_tables[piece_type][sq]);
+        }
+      } else {
+        // Compute the score contribution of a black piece.
+        mirror_sq =
+            GetSqFromRankFile(kRank8 - GetRankFromSq(sq), GetFileFromSq(sq));
+        if (piece_type == kKing) {
+          // Compute the tapered evalution for the king position.
+          material_bonus -= eval_params.piece_vals[kKing];
+          material_bonus -=
+              ((eval_params.piece_sq_tables[kKing][mirror_sq] *
+                    (kPhaseNorm - phase) +
+                eval_params.endgame_king_piece_sq_table[mirror_sq] * phase) /
+               kPhaseNorm);
+        } else {
+          material_bonus -=
+              (eval_params.piece_vals[piece_type] +
+               eval_params.piece_sq_tables[piece_type][mirror_sq]);
+        }
+      }
+    }
+  }
+  return material_bonus;
+}
+
+// Compute the pawn structure term of the evaluation with a loop over files,
+// as the evaluation did before it used bitboard fills.
+auto EvaluatePawnStructureByFile(const Board& board) -> int {
+  const EvalParams& eval_params = kDefaultEvalParams;
+  Bitboard white_attackspan = 0X0;
+  Bitboard white_attack_map = 0X0;
+  Bitboard white_defender_map = 0X0;
+  Bitboard black_attackspan = 0X0;
+  Bitboard black_attack_map = 0X0;
+  Bitboard black_defender_map = 0X0;
+  for (S8 sq = kSqA1; sq <= kSqH8; ++sq) {
+    if (board.GetPieceOnSq(sq) == kPawn) {
+      if (board.GetPlayerOnSq(sq) == kWhite) {
+        white_attackspan |= kPawnFrontAttackspanMasks[kWhite][sq];
+        white_attack_map |= kNonSliderAttackMaps[kWhitePawnCapture][sq];
+        white_defender_map |= kNonSliderAttackMaps[kBlackPawnCapture][sq];
+      } else {
+        black_attackspan |= kPawnFrontAttackspanMasks[kBlack][sq];
+        black_attack_map |= kNonSliderAttackMaps[kBlackPawnCapture][sq];
+        black_defender_map |= kNonSliderAttackMaps[kWhitePawnCapture][sq];
+      }
+    }
+  }
+
+  Bitboard backward_pawns;
+  Bitboard defenders;
+  Bitboard pawns;
+  Bitboard pawns_on_file;
+  Bitboard pawn_stops;
+  Bitboard pawns_with_east_neighbor;
+  Bitboard neighor_files;
+  Bitboard king_board;
+  int pawn_eval = 0;
+  S8 player_side;
+  S8 pawn_sq;
+  S8 passer_rank;
+  S8 king_sq;
+  S8 king_rank;
+  S8 king_file;
+  S8 east_pawn_shield_sq;
+  S8 center_pawn_shield_sq;
+  S8 west_pawn_shield_sq;
+  S8 pawn_shield_dir;
+  for (S8 player = kWhite; player <= kBlack; ++player) {
+    pawns = board.GetPiecesByType(kPawn, player);
+    player_side = (player == kWhite) ? 1 : -1;
+    for (S8 file = kFileA; file <= kFileH; ++file) {
+      pawns_on_file = pawns & kFileMasks[file];
+      if (static_cast<bool>(pawns_on_file)) {
+        if (MultipleSetSq(pawns_on_file)) {
+          // Add a penalty for doubled pawns.
+          pawn_eval -= (player_side * eval_params.doubled_pawn_penalty);
+        } else {
+          // Determine if a lone pawn on a file is a passer.
+          pawn_sq = GetSqOfFirstPiece(pawns_on_file);
+          if (!static_cast<bool>(
+                  kPawnFrontSpanMasks[player][pawn_sq] &
+                  board.GetPiecesByType(kPawn, GetOtherPlayer(player)))) {
+            // Add a bonus for passed pawns.
+            passer_rank = GetRankFromSq(pawn_sq);
+            pawn_eval += (player_side *
+                          eval_params.passed_pawn_bonuses[passer_rank]);
+
+            // Add a bonus for rooks behind passed pawns.
+            if (static_cast<bool>(board.GetPiecesByType(kRook, player) &
+                                  kFileMasks[file])) {
+              pawn_eval += (player_side *
+                            eval_params.rook_behind_passed_pawn_bonus);
+            }
+          } else {
+            // Compute neighbor file bitmask.
+            neighor_files = 0X0;
+            if (file != kFileA) {
+              neighor_files |= kFileMasks[file - 1];
+            }
+            if (file != kFileH) {
+              neighor_files |= kFileMasks[file + 1];
+            }
+            // Determine if a non-passer pawn is isolated.
+            if (!static_cast<bool>(neighor_files & pawns)) {
+              // Add penalties for isolated pawns that aren't passers.
+              pawn_eval -= (player_side * eval_params.isolated_pawn_penalty);
+            }
+          }
+        }
+      }
+    }
+
+    // Add penalties for backward pawns.
+    pawn_stops = (player == kWhite)
+                     ? board.GetPiecesByType(kPawn, kWhite) << kNumFiles
+                     : board.GetPiecesByType(kPawn, kBlack) >> kNumFiles;
+    backward_pawns =
+        (player == kWhite)
+            ? (pawn_stops & black_attack_map & ~white_attackspan) >> kNumFiles
+            : (pawn_stops & white_attack_map & ~black_attackspan) << kNumFiles;
+    pawn_eval -= (player_side * GetNumSetSq(backward_pawns) *
+                  eval_params.backward_pawn_penalty);
+
+    // Add bonuses for pawns with a east neighbor, which are at least members
+    // of a duo.
+    pawns_with_east_neighbor = (board.GetPiecesByType(kPawn, player) >> 1) &
+                               board.GetPiecesByType(kPawn, player) &
+                               ~kFileMasks[kFileH];
+    pawn_eval += (player_side * GetNumSetSq(pawns_with_east_neighbor) *
+                  eval_params.neighbor_bonus);
+
+    // Add bonuses for defended pawns.
+    defenders =
+        (player == kWhite)
+            ? (board.GetPiecesByType(kPawn, kWhite) & white_defender_map)
+            : (board.GetPiecesByType(kPawn, kBlack) & black_defender_map);
+    pawn_eval += (player_side * GetNumSetSq(defenders) *
+                  eval_params.defender_bonus);
+
+    // Add penalties for holes in the pawn shield next to a castled king.
+    king_board = board.GetPiecesByType(kKing, player);
+    king_sq = GetSqOfFirstPiece(king_board);
+    king_rank = GetRankFromSq(king_sq);
+    king_file = GetFileFromSq(king_sq);
+    // Check if the king is in its "pawn shelter".
+    if (king_file != kFileD && king_rank != kFileE) {
+      if (player == kWhite && (king_rank == kRank1 || king_rank == kRank2)) {
+        pawn_shield_dir = 1;
+      } else if (player == kBlack &&
+                 (king_rank == kRank7 || king_rank == kRank8)) {
+        pawn_shield_dir = -1;
+      } else {
+        continue;
+      }
+      if (king_file != kFileA) {
+        east_pawn_shield_sq =
+            GetSqFromRankFile(king_rank + pawn_shield_dir, king_file - 1);
+        if (board.GetPlayerOnSq(east_pawn_shield_sq) != player ||
+            board.GetPieceOnSq(east_pawn_shield_sq) != kPawn) {
+          pawn_eval -=
+              (player_side * eval_params.king_pawn_shield_hole_penalty);
+        }
+      }
+      if (king_file != kFileH) {
+        west_pawn_shield_sq =
+            GetSqFromRankFile(king_rank + pawn_shield_dir, king_file + 1);
+        if (board.GetPlayerOnSq(west_pawn_shield_sq) != player ||
+            board.GetPieceOnSq(west_pawn_shield_sq) != kPawn) {
+          pawn_eval -=
+              (player_side * eval_params.king_pawn_shield_hole_penalty);
+        }
+      }
+      center_pawn_shield_sq =
+          GetSqFromRankFile(king_rank + pawn_shield_dir, king_file);
+      if (board.GetPlayerOnSq(center_pawn_shield_sq) != player ||
+          board.GetPieceOnSq(center_pawn_shield_sq) != kPawn) {
+        pawn_eval -=
+            (player_side * eval_params.king_pawn_shield_hole_penalty);
+      }
+    }
+  }
+  return pawn_eval;
+}
+
+// Store the positions one move away from the benchmark positions as the legal
+// moves from each benchmark position.
+struct EvalBenchPositions {
+  vector<vector<Move>> moves;
+  int num_positions = 0;
+};
+
+auto GetEvalBenchPositions() -> EvalBenchPositions {
+  EvalBenchPositions positions;
+  positions.moves.resize(kNumBenchPositions);
+  SearchOptions search_options;
+  search_options.verbose = false;
+  for (int pos_idx = 0; pos_idx < kNumBenchPositions; ++pos_idx) {
+    Board board(kBenchPositions[pos_idx]);
+    Engine engine(&board, 'w', 1.0f, search_options);
+    for (const Move& move : engine.GenerateMoves()) {
+      try {
+        board.MakeMove(move);
+      } catch (BadMove& e) {
+        continue;
+      }
+      board.UnmakeMove(move);
+      positions.moves[pos_idx].push_back(move);
+      ++positions.num_positions;
+    }
+  }
+  return positions;
+}
+
+// Return the time in nanoseconds spent making and unmaking the moves of every
+// position num_rounds times, calling the evaluation function on each position
+// reached. The sum of the evaluations is added to checksum, which also keeps
+// the calls from being optimized away. If clear_eval_cache is set, the
+// evaluation cache is cleared before each round so that every position misses
+// it.
+template <typename EvalFunc>
+auto TimeEvalFunc(Board& board, const EvalBenchPositions& positions,
+                  int num_rounds, EvalFunc eval_func, long long& checksum,
+                  bool clear_eval_cache = false) -> double {
+  high_resolution_clock::time_point start = high_resolution_clock::now();
+  for (int round = 0; round < num_rounds; ++round) {
+    if (clear_eval_cache) {
+      board.ClearEvalCache();
+    }
+    for (int pos_idx = 0; pos_idx < kNumBenchPositions; ++pos_idx) {
+      board.SetPos(kBenchPositions[pos_idx]);
+      for (const Move& move : positions.moves[pos_idx]) {
+        board.MakeMove(move);
+        checksum += eval_func(board);
+        board.UnmakeMove(move);
+      }
+    }
+  }
+  return duration_cast<duration<double, std::nano>>(
+             high_resolution_clock::now() - start)
+      .count();
+}
+
+}  // namespace
+
+auto RunBench(int depth, SearchOptions search_options,
+              bool count_perf_events) -> void {
+  if (depth < 1) {
+    throw invalid_argument("Bench depth must be at least one");
+  }
+
+  // Search each position to a fixed depth without printing search info.
+  search_options.depth_limit = depth;
+  search_options.verbose = false;
+  constexpr float kUnusedSearchTime = 1.0f;
+  U64 total_node_count = 0;
+  float total_search_time = 0.0f;
+  unique_ptr<PerfCounters> perf_counters;
+  if (count_perf_events) {
+    perf_counters = make_unique<PerfCounters>();
+  }
+  for (int pos_idx = 0; pos_idx < kNumBenchPositions; ++pos_idx) {
+    Board board(kBenchPositions[pos_idx]);
+    Engine engine(&board, 'w', kUnusedSearchTime, search_options);
+
+    high_resolution_clock::time_point search_start = high_resolution_clock::now();
+    if (perf_counters) {
+      perf_counters->Start();
+    }
+    engine.GetBestMove();
+    if (perf_counters) {
+      perf_counters->Stop();
+    }
+    total_search_time += duration_cast<duration<float>>(
+                             high_resolution_clock::now() - search_start)
+                             .count();
+
+    U64 node_count = engine.GetNodeCount();
+    total_node_count += node_count;
+    cout << "Position " << pos_idx + 1 << "/" << kNumBenchPositions << ": "
+         << node_count << " nodes" << endl;
+  }
+
+  U64 nodes_per_sec =
+      (total_search_time > 0.0f)
+          ? static_cast<U64>(static_cast<float>(total_node_count) /
+                             total_search_time)
+          : 0;
+  cout << "\nTotal time (ms): "
+       << static_cast<U64>(total_search_time * 1000.0f) << endl;
+  cout << "Nodes searched: " << total_node_count << endl;
+  cout << "Nodes/second: " << nodes_per_sec << endl;
+  if (perf_counters) {
+    perf_counters->Output(total_node_count);
+  }
+}
+
+auto RunEvalBench(int num_rounds) -> void {
+  if (num_rounds < 1) {
+    throw invalid_argument("Number of evaluation benchmark rounds must be at "
+                           "least one");
+  }
+
+  EvalBenchPositions positions = GetEvalBenchPositions();
+  Board board(kBenchPositions[0]);
+
+  // Check that the bitboard evaluation terms match the scalar reference in
+  // every position before timing them.
+  for (int pos_idx = 0; pos_idx < kNumBenchPositions; ++pos_idx) {
+    board.SetPos(kBenchPositions[pos_idx]);
+    for (const Move& move : positions.moves[pos_idx]) {
+      board.MakeMove(move);
+      if (board.EvaluatePiecePositions() !=
+              EvaluatePiecePositionsBySq(board) ||
+          board.EvaluatePawnStructure() != EvaluatePawnStructureByFile(board)) {
+        throw runtime_error("evaluation benchmark, where the bitboard and "
+                            "scalar evaluations differ");
+      }
+      board.UnmakeMove(move);
+    }
+  }
+
+  // Time each function over the same positions. The times include setting up
+  // each position, which is timed on its own for comparison, rather than
+  // subtracted, since the difference can fall below the timer's noise.
+  long long checksum = 0;
+  double num_evals = static_cast<double>(positions.num_positions) * num_rounds;
+  // Run one untimed round first so that the setup isn't timed with cold
+  // caches.
+  TimeEvalFunc(
+      board, positions, 1, [](Board& pos) { return pos.Evaluate(); }, checksum);
+  auto output_time = [&](const string& label, double time) {
+    cout << label << ": " << time / num_evals << " ns" << endl;
+  };
+  output_time("Position setup",
+              TimeEvalFunc(
+                  board, positions, num_rounds,
+                  [](const Board& pos) { return pos.GetPlayerToMove(); },
+                  checksum));
+  output_time("Position setup, clearing the eval cache",
+              TimeEvalFunc(
+                  board, positions, num_rounds,
+                  [](const Board& pos) { return pos.GetPlayerToMove(); },
+                  checksum, true));
+  output_time("Material and piece squares (bitboard)",
+              TimeEvalFunc(
+                  board, positions, num_rounds,
+                  [](const Board& pos) { return pos.EvaluatePiecePositions(); },
+                  checksum));
+  output_time("Material and piece squares (scalar)",
+              TimeEvalFunc(board, positions, num_rounds,
+                           EvaluatePiecePositionsBySq, checksum));
+  output_time("Pawn structure (bitboard)",
+              TimeEvalFunc(
+                  board, positions, num_rounds,
+                  [](const Board& pos) { return pos.EvaluatePawnStructure(); },
+                  checksum));
+  output_time("Pawn structure (scalar)",
+              TimeEvalFunc(board, positions, num_rounds,
+                           EvaluatePawnStructureByFile, checksum));
+  output_time("Evaluate() with pawn table, eval cache misses",
+              TimeEvalFunc(
+                  board, positions, num_rounds,
+                  [](Board& pos) { return pos.Evaluate(); }, checksum, true));
+  output_time("Evaluate() with pawn table, eval cache hits",
+              TimeEvalFunc(board, positions, num_rounds,
+                           [](Board& pos) { return pos.Evaluate(); },
+                           checksum));
+  cout << "\nPositions: " << positions.num_positions << " x " << num_rounds
+       << " rounds" << endl;
+  cout << "Checksum: " << checksum << endl;
+}
+
+}  // namespace omegazero
@@ -0,0 +1,42 @@
+/* Noah Himed
+ *
+ * Define a fixed-depth search benchmark over a built-in set of positions, used
+ * to measure search speed and detect changes in search behavior.
+ *
+ * Licensed under MIT License. Terms and conditions enclosed in "LICENSE.txt".
+ */
+
+#ifndef OMEGAZERO_SRC_BENCH_H_
+#define OMEGAZERO_SRC_BENCH_H_
+
+#include <string>
+
+#include "engine.h"
+
+namespace omegazero {
+
+constexpr int kDefaultBenchDepth = 5;
+constexpr int kDefaultEvalBenchRounds = 200;
+
+constexpr int kNumBenchPositions = 40;
+
+// Store a set of openings, middlegames, and endgames (including positions with
+// castling, en passent, promotions, and stalemate) to benchmark with.
+extern const std::string kBenchPositions[kNumBenchPositions];
+
+// Search every benchmark position to the given depth on a single thread and
+// output the total node count and the nodes searched per second. The node
+// count acts as a signature of the search, and should only change when search
+// behavior changes. If count_perf_events is set, hardware performance counters
+// are read around the searches and output per node.
+auto RunBench(int depth, SearchOptions search_options,
+              bool count_perf_events = false) -> void;
+// Time the terms of the evaluation over every position one move away from the
+// benchmark positions, repeated for the given number of rounds, and output the
+// time per position of the bitboard evaluation and of the scalar, square by
+// square evaluation it replaced. The two are checked to agree first.
+auto RunEvalBench(int num_rounds) -> void;
+
+}  // namespace omegazero
+
+#endif  // OMEGAZERO_SRC_BENCH_H_
@@ -10,7 +10,6 @@
 #include <algorithm>
 #include <boost/multiprecision/cpp_int.hpp>
 #include <cctype>
-#include <chrono>
 #include <cstdint>
 #include <random>
 #include <stdexcept>
@@ -18,6 +17,7 @@
 #include <unordered_map>
 
 #include "bad_move.h"
+#include "eval_params.h"
 #include "move.h"
 
 namespace omegazero {
@@ -28,33 +28,33 @@ using std::cout;
 using std::end;
 using std::endl;
 using std::invalid_argument;
+using std::max;
 using std::string;
 
 typedef boost::multiprecision::uint128_t U128;
 
-Board::Board(const string& init_pos) {
-  for (S8 piece_type = kPawn; piece_type <= kKing; ++piece_type) {
-    pieces_[piece_type] = 0ULL;
-  }
-  for (S8 player = kWhite; player <= kBlack; ++player) {
-    player_pieces_[player] = 0ULL;
-    // Initialize all castling rights to false before parsing the FEN string to
-    // set the board, which may reset some castling rights to true.
-    for (S8 board_side = kQueenSide; board_side <= kKingSide; ++board_side) {
-      castling_rights_[player][board_side] = false;
-    }
+auto GetSliderAttackMap(S8 sq, S8 slider_map_index, Bitboard occupancy)
+    -> Bitboard {
+  // Use the magic bitboard method to get possible moves for bishops and
+  // rooks. The Boost library's 128 bit unsigned int data type "U128"
+  // is used here to avoid integer overflow.
+  Bitboard blockers = kSliderPieceMaps[slider_map_index][sq] & occupancy;
+  if (blockers == 0X0) {
+    return kUnblockedSliderAttackMaps[slider_map_index][sq];
   }
-  ep_target_sq_ = kNA;
-  // Initialize player to move as White in case the FEN string doesn't specify.
-  player_to_move_ = kWhite;
 
-  // Initialize neither side as having castled.
-  castling_status_[kBlack] = false;
-  castling_status_[kWhite] = false;
+  const S8* magic_lengths = (slider_map_index == kBishopMoves)
+                                ? kBishopMagicLengths
+                                : kRookMagicLengths;
+  U128 magic = kMagics[slider_map_index][sq];
+  U128 index = (blockers * magic) >> (kNumSq - magic_lengths[sq]);
+  U64 index_U64 = static_cast<U64>(index);
+  return kMagicIndexToAttackMap.at(index_U64);
+}
 
-  // Set the piece positions, castling rights, and player to move.
-  InitBoardPos(init_pos);
-  InitHash();
+Board::Board(const string& init_pos)
+    : eval_params_(nullptr), nnue_network_(nullptr), nnue_stack_(1) {
+  SetPos(init_pos);
 }
 
 auto Board::GetAttackMap(S8 attacking_player, S8 sq, S8 attacking_piece) const
@@ -87,33 +87,14 @@ auto Board::GetAttackMap(S8 attacking_player, S8 sq, S8 attacking_piece) const
     case kKnight:
       attack_map = kNonSliderAttackMaps[kKnightAttack][sq];
       break;
-    // Use the magic bitboard method to get possible moves for bishops and
-    // rooks. The Boost library's 128 bit unsigned int data type "U128"
-    // is used here to avoid integer overflow.
     case kBishop: {
       Bitboard all_pieces = player_pieces_[kWhite] | player_pieces_[kBlack];
-      Bitboard blockers = kSliderPieceMaps[kBishopMoves][sq] & all_pieces;
-      if (blockers == 0X0) {
-        attack_map = kUnblockedSliderAttackMaps[kBishopMoves][sq];
-      } else {
-        U128 magic = kMagics[kBishopMoves][sq];
-        U128 index = (blockers * magic) >> (kNumSq - kBishopMagicLengths[sq]);
-        U64 index_U64 = static_cast<U64>(index);
-        attack_map = kMagicIndexToAttackMap.at(index_U64);
-      }
+      attack_map = GetSliderAttackMap(sq, kBishopMoves, all_pieces);
       break;
     }
     case kRook: {
       Bitboard all_pieces = player_pieces_[kWhite] | player_pieces_[kBlack];
-      Bitboard blockers = kSliderPieceMaps[kRookMoves][sq] & all_pieces;
-      if (blockers == 0X0) {
-        attack_map = kUnblockedSliderAttackMaps[kRookMoves][sq];
-      } else {
-        U128 magic = kMagics[kRookMoves][sq];
-        U128 index = (blockers * magic) >> (kNumSq - kRookMagicLengths[sq]);
-        U64 index_U64 = static_cast<U64>(index);
-        attack_map = kMagicIndexToAttackMap.at(index_U64);
-      }
+      attack_map = GetSliderAttackMap(sq, kRookMoves, all_pieces);
       break;
     }
     // Combine the attack maps of a rook and bishop to get a queen's attack.
@@ -156,32 +137,28 @@ auto Board::GetPiecesByType(S8 piece_type, S8 player) const -> Bitboard {
 }
 
 auto Board::CastlingLegal(S8 board_side) const -> bool {
+  if (board_side != kQueenSide && board_side != kKingSide) {
+    throw invalid_argument("board_side in Board::CastlingLegal()");
+  }
+
   // For castling moves, check that the following hold:
   //   * Neither the king nor the chosen rook has previously moved.
   //   * There are no pieces between the king and the chosen rook.
   //   * The king is not currently in check.
   //   * The king does not pass through a square that is attacked by an enemy
   //     piece.
-  if (board_side == kQueenSide) {
-    return castling_rights_[player_to_move_][kQueenSide] && !KingInCheck() &&
-           ((player_to_move_ == kWhite && piece_layout_[kSqB1] == kNA &&
-             piece_layout_[kSqC1] == kNA && piece_layout_[kSqD1] == kNA &&
-             GetAttackersToSq(kSqD1, kWhite) == 0X0) ||
-            (player_to_move_ == kBlack && GetPieceOnSq(kSqB8) == kNA &&
-             piece_layout_[kSqC8] == kNA && piece_layout_[kSqD8] == kNA &&
-             GetAttackersToSq(kSqD8, kBlack) == 0X0));
-  }
-  if (board_side == kKingSide) {
-    return castling_rights_[player_to_move_][kKingSide] && !KingInCheck() &&
-           ((player_to_move_ == kWhite && piece_layout_[kSqF1] == kNA &&
-             GetAttackersToSq(kSqF1, kWhite) == 0X0 &&
-             piece_layout_[kSqG1] == kNA) ||
-            (player_to_move_ == kBlack && GetPieceOnSq(kSqF8) == kNA &&
-             GetAttackersToSq(kSqF8, kBlack) == 0X0 &&
-             piece_layout_[kSqG8] == kNA));
-  }
-
-  throw invalid_argument("board_side in Board::CastlingLegal()");
+  // Squares are indexed by player, then by board side.
+  constexpr S8 kKingSqs[kNumPlayers] = {kSqE1, kSqE8};
+  constexpr S8 kRookSqs[kNumPlayers][2] = {{kSqA1, kSqH1}, {kSqA8, kSqH8}};
+  constexpr S8 kPassedSqs[kNumPlayers][2] = {{kSqD1, kSqF1}, {kSqD8, kSqF8}};
+  Bitboard occupancy = player_pieces_[kWhite] | player_pieces_[kBlack];
+  return castling_rights_[player_to_move_][board_side] &&
+         !(kBetweenMasks[kKingSqs[player_to_move_]]
+                        [kRookSqs[player_to_move_][board_side]] &
+           occupancy) &&
+         !KingInCheck() &&
+         GetAttackersToSq(kPassedSqs[player_to_move_][board_side],
+                          player_to_move_) == 0X0;
 }
 
 auto Board::DoublePawnPushLegal(S8 file) const -> bool {
@@ -205,68 +182,37 @@ auto Board::DoublePawnPushLegal(S8 file) const -> bool {
 }
 
 auto Board::Evaluate() -> int {
-  int board_score = 0;
-  Bitboard white_pawn_attackspan;
-  Bitboard white_pawn_attack_map;
-  Bitboard white_pawn_defender_map;
-  Bitboard black_pawn_attackspan;
-  Bitboard black_pawn_attack_map;
-  Bitboard black_pawn_defender_map;
-  // Count material and add positional bonuses using Piece Square Tables.
-  board_score += EvaluatePiecePositions(
-      white_pawn_attackspan, white_pawn_attack_map, white_pawn_defender_map,
-      black_pawn_attackspan, black_pawn_attack_map, black_pawn_defender_map);
-
-  // Evaluate pawn structure.
-  int pawn_eval;
-  U64 pawn_hash = GetPawnHash();
-  if (!pawn_table_.Access(pawn_hash, pawn_eval)) {
-    pawn_eval = EvaluatePawnStructure(
-        white_pawn_attackspan, white_pawn_attack_map, white_pawn_defender_map,
-        black_pawn_attackspan, black_pawn_attack_map, black_pawn_defender_map);
-    pawn_table_.Update(pawn_hash, pawn_eval);
+  int eval;
+  if (eval_cache_.Access(board_hash_, eval)) {
+    return eval;
   }
-  board_score += pawn_eval;
 
-  // Evaluate miscelaneous piece bonuses/penalties.
-  constexpr int kBishopPairBonus = 12;
-  constexpr int kConnectedRookBonus = 25;
-  constexpr int kCastlingRightsLossPenalty = 6;
-  S8 player_side;
-  S8 first_sq;
-  Bitboard bishops;
-  Bitboard rooks;
-  for (S8 player = kWhite; player <= kBlack; ++player) {
-    player_side = (player == kWhite) ? 1 : -1;
-
-    // Add a bonus for a bishop pair.
-    bishops = GetPiecesByType(kBishop, player);
-    if (GetNumSetSq(bishops) >= 2) {
-      board_score += (player_side * kBishopPairBonus);
-    }
-
-    // Add a bonus for connected rooks.
-    rooks = GetPiecesByType(kRook, player);
-    if (GetNumSetSq(rooks) >= 2) {
-      first_sq = GetSqOfFirstPiece(rooks);
-      if (static_cast<bool>(GetAttackMap(player, first_sq, kRook) & rooks)) {
-        board_score += (player_side * kConnectedRookBonus);
-      }
-    }
+  if (nnue_network_ != nullptr) {
+    UpdateNnueAccumulator(kWhite);
+    UpdateNnueAccumulator(kBlack);
+    eval = nnue_network_->Evaluate(nnue_stack_[nnue_ply_].accumulator,
+                                   player_to_move_);
+  } else if (eval_params_ == nullptr) {
+    eval = EvaluateWithParams<true>();
+  } else {
+    eval = EvaluateWithParams<false>();
+  }
+  eval_cache_.Update(board_hash_, eval);
+  return eval;
+}
 
-    // Add a penalty for losing castling rights.
-    if (!castling_status_[player]) {
-      if (!castling_rights_[player][kQueenSide]) {
-        board_score -= (player_side * kCastlingRightsLossPenalty);
-      }
-      if (!castling_rights_[player][kKingSide]) {
-        board_score -= (player_side * kCastlingRightsLossPenalty);
-      }
-    }
+auto Board::EvaluatePiecePositions() const -> int {
+  if (eval_params_ == nullptr) {
+    return EvaluatePiecePositionsWithParams<true>();
   }
+  return EvaluatePiecePositionsWithParams<false>();
+}
 
-  S8 moving_side = (player_to_move_ == kWhite) ? 1 : -1;
-  return board_score * moving_side;
+auto Board::EvaluatePawnStructure() const -> int {
+  if (eval_params_ == nullptr) {
+    return EvaluatePawnStructureWithParams<true>();
+  }
+  return EvaluatePawnStructureWithParams<false>();
 }
 
 auto Board::ResetPos() -> void {
@@ -302,6 +248,8 @@ auto Board::ResetPos() -> void {
 
   board_hash_ = saved_pos_info_.board_hash;
   pawn_hash_ = saved_pos_info_.pawn_hash;
+
+  nnue_ply_ = saved_pos_info_.nnue_ply;
 }
 
 auto Board::SavePos() -> void {
@@ -335,9 +283,56 @@ auto Board::SavePos() -> void {
 
   saved_pos_info_.board_hash = board_hash_;
   saved_pos_info_.pawn_hash = pawn_hash_;
+
+  saved_pos_info_.nnue_ply = nnue_ply_;
+}
+
+auto Board::SetPos(const string& init_pos) -> void {
+  for (S8 piece_type = kPawn; piece_type <= kKing; ++piece_type) {
+    pieces_[piece_type] = 0ULL;
+  }
+  for (S8 player = kWhite; player <= kBlack; ++player) {
+    player_pieces_[player] = 0ULL;
+    // Initialize all castling rights to false before parsing the FEN string to
+    // set the board, which may reset some castling rights to true.
+    for (S8 board_side = kQueenSide; board_side <= kKingSide; ++board_side) {
+      castling_rights_[player][board_side] = false;
+    }
+  }
+  ep_target_sq_ = kNA;
+  // Mark the halfmove clock as unset so the FEN parser can accumulate its
+  // digits.
+  halfmove_clock_ = kNA;
+  // Initialize player to move as White in case the FEN string doesn't specify.
+  player_to_move_ = kWhite;
+
+  // Initialize neither side as having castled.
+  castling_status_[kBlack] = false;
+  castling_status_[kWhite] = false;
+
+  // Forget the history of moves made from any previous position.
+  white_queenside_castling_rights_history_ = stack<bool>();
+  white_kingside_castling_rights_history_ = stack<bool>();
+  black_queenside_castling_rights_history_ = stack<bool>();
+  black_kingside_castling_rights_history_ = stack<bool>();
+  ep_target_sq_history_ = stack<S8>();
+  halfmove_clock_history_ = stack<S8>();
+
+  // Set the piece positions, castling rights, and player to move.
+  InitBoardPos(init_pos);
+  InitHash();
+
+  // Start a new NNUE stack, whose first accumulator is computed on demand.
+  nnue_ply_ = 0;
+  nnue_stack_[0].accumulator.computed[kWhite] = false;
+  nnue_stack_[0].accumulator.computed[kBlack] = false;
 }
 
 auto Board::MakeMove(const Move& move) -> void {
+  if (nnue_network_ != nullptr) {
+    PushNnueMove(move);
+  }
+
   if (move.castling_type == kNA) {
     MakeNonCastlingMove(move);
   } else if (move.castling_type == kQueenSide) {
@@ -363,6 +358,9 @@ auto Board::MakeMove(const Move& move) -> void {
       castling_status_[kBlack] = true;
     }
   }
+  if (move.castling_type != kNA) {
+    board_hash_ ^= castled_rand_nums_[player_to_move_];
+  }
 
   // Update the en passent target square and the board hash to reflect a
   // change in the file of the en passent target square.
@@ -404,6 +402,76 @@ auto Board::MakeMove(const Move& move) -> void {
   SwitchPlayer();
 }
 
+auto Board::GetChildHash(const Move& move, U64& child_pawn_hash) const -> U64 {
+  U64 board_hash = board_hash_ ^ black_to_move_rand_num_;
+  child_pawn_hash = pawn_hash_;
+  S8 prev_ep_target_file =
+      (ep_target_sq_ == kNA) ? kNA : GetFileFromSq(ep_target_sq_);
+  S8 curr_ep_target_file = (move.new_ep_target_sq == kNA)
+                               ? kNA
+                               : GetFileFromSq(move.new_ep_target_sq);
+  if (prev_ep_target_file != curr_ep_target_file) {
+    if (prev_ep_target_file != kNA) {
+      board_hash ^= ep_file_rand_nums_[prev_ep_target_file];
+    }
+    if (curr_ep_target_file != kNA) {
+      board_hash ^= ep_file_rand_nums_[curr_ep_target_file];
+    }
+  }
+
+  if (move.castling_type != kNA) {
+    // Move the king and rook from their squares on the back rank.
+    S8 back_rank_sq = (player_to_move_ == kWhite) ? kSqA1 : kSqA8;
+    S8 king_sq = back_rank_sq + kFileE;
+    S8 rook_sq = back_rank_sq + kFileH;
+    S8 king_target_sq = back_rank_sq + kFileG;
+    S8 rook_target_sq = back_rank_sq + kFileF;
+    if (move.castling_type == kQueenSide) {
+      rook_sq = back_rank_sq + kFileA;
+      king_target_sq = back_rank_sq + kFileC;
+      rook_target_sq = back_rank_sq + kFileD;
+    }
+    return board_hash ^ castled_rand_nums_[player_to_move_] ^
+           piece_rand_nums_[player_to_move_][kKing][king_sq] ^
+           piece_rand_nums_[player_to_move_][kKing][king_target_sq] ^
+           piece_rand_nums_[player_to_move_][kRook][rook_sq] ^
+           piece_rand_nums_[player_to_move_][kRook][rook_target_sq];
+  }
+
+  if (move.captured_piece != kNA) {
+    S8 other_player = GetOtherPlayer(player_to_move_);
+    // A pawn captured en passent stands beside the capturing pawn.
+    S8 capture_sq = move.is_ep
+                        ? GetSqFromRankFile(GetRankFromSq(move.start_sq),
+                                            GetFileFromSq(move.target_sq))
+                        : move.target_sq;
+    board_hash ^=
+        piece_rand_nums_[other_player][move.captured_piece][capture_sq];
+    if (move.captured_piece == kPawn) {
+      child_pawn_hash ^= piece_rand_nums_[other_player][kPawn][capture_sq];
+    }
+  }
+  S8 placed_piece = (move.promoted_to_piece == kNA) ? move.moving_piece
+                                                     : move.promoted_to_piece;
+  board_hash ^=
+      piece_rand_nums_[player_to_move_][move.moving_piece][move.start_sq] ^
+      piece_rand_nums_[player_to_move_][placed_piece][move.target_sq];
+  if (move.moving_piece == kPawn) {
+    child_pawn_hash ^= piece_rand_nums_[player_to_move_][kPawn][move.start_sq];
+    if (placed_piece == kPawn) {
+      child_pawn_hash ^=
+          piece_rand_nums_[player_to_move_][kPawn][move.target_sq];
+    }
+  }
+  return board_hash;
+}
+
+auto Board::PrefetchPawnEntry(U64 pawn_hash) const -> void {
+  if (pawn_hash != pawn_hash_) {
+    pawn_table_.Prefetch(pawn_hash);
+  }
+}
+
 auto Board::MakeNullMove() -> void {
   // Store the previous en passent target square and set current en passent
   // target square value to null.
@@ -456,6 +524,9 @@ auto Board::UnmakeMove(const Move& move) -> void {
       castling_status_[kBlack] = false;
     }
   }
+  if (move.castling_type != kNA) {
+    board_hash_ ^= castled_rand_nums_[player_to_move_];
+  }
 
   // Revert the halfmove clock.
   halfmove_clock_ = halfmove_clock_history_.top();
@@ -502,6 +573,11 @@ auto Board::UnmakeMove(const Move& move) -> void {
         black_kingside_castling_rights_history_.top();
   }
   black_kingside_castling_rights_history_.pop();
+
+  // Return to the accumulator of the previous ply.
+  if (nnue_network_ != nullptr) {
+    --nnue_ply_;
+  }
 }
 
 // Assume the last made move was a null move with MakeNullMove().
@@ -522,6 +598,89 @@ auto Board::UnmakeNullMove() -> void {
   }
 }
 
+auto Board::GetPinnedPieces(S8 player) const -> Bitboard {
+  S8 king_sq = GetSqOfFirstPiece(pieces_[kKing] & player_pieces_[player]);
+  Bitboard enemy_pieces = player_pieces_[GetOtherPlayer(player)];
+  Bitboard diagonal_sliders =
+      (pieces_[kBishop] | pieces_[kQueen]) & enemy_pieces;
+  Bitboard orthogonal_sliders =
+      (pieces_[kRook] | pieces_[kQueen]) & enemy_pieces;
+  if (!(kQueenRayMasks[king_sq] & (diagonal_sliders | orthogonal_sliders))) {
+    return 0X0;
+  }
+
+  // Find the enemy sliders that would attack the king on an empty board. A
+  // piece is pinned if it's the only piece between the king and such a slider.
+  Bitboard snipers =
+      (kUnblockedSliderAttackMaps[kBishopMoves][king_sq] & diagonal_sliders) |
+      (kUnblockedSliderAttackMaps[kRookMoves][king_sq] & orthogonal_sliders);
+  Bitboard occupancy = player_pieces_[kWhite] | player_pieces_[kBlack];
+  Bitboard pinned_pieces = 0X0;
+  while (snipers) {
+    S8 sniper_sq = GetSqOfFirstPiece(snipers);
+    Bitboard blockers = kBetweenMasks[king_sq][sniper_sq] & occupancy;
+    if (OneSqSet(blockers)) {
+      pinned_pieces |= blockers & player_pieces_[player];
+    }
+    RemoveFirstPiece(snipers);
+  }
+  return pinned_pieces;
+}
+
+auto Board::MoveLegal(const Move& move, Bitboard pinned_pieces,
+                      Bitboard checkers) const -> bool {
+  Bitboard king_board = pieces_[kKing] & player_pieces_[player_to_move_];
+  S8 king_sq = GetSqOfFirstPiece(king_board);
+  Bitboard enemy_pieces = player_pieces_[GetOtherPlayer(player_to_move_)];
+  Bitboard occupancy = player_pieces_[kWhite] | player_pieces_[kBlack];
+
+  // Castling moves were generated only if the king isn't in check and
+  // doesn't pass through an attacked square, leaving its destination to be
+  // checked. The rook always ends up between the king and any attacker along
+  // the back rank, so the king can be removed from the occupancy.
+  if (move.castling_type != kNA) {
+    constexpr S8 kKingTargetSqs[kNumPlayers][2] = {{kSqC1, kSqG1},
+                                                   {kSqC8, kSqG8}};
+    S8 target_sq = kKingTargetSqs[player_to_move_][move.castling_type];
+    return !(GetAttackersToSq(target_sq, occupancy ^ king_board) &
+             enemy_pieces);
+  }
+
+  // The king can't move onto an attacked square, including squares behind it
+  // on the line of a checking slider.
+  if (move.moving_piece == kKing) {
+    return !(GetAttackersToSq(move.target_sq, occupancy ^ king_board) &
+             enemy_pieces);
+  }
+
+  // En passent captures remove two pieces from the same rank, so look for
+  // attacks on the king through the occupancy after the capture.
+  if (move.is_ep) {
+    S8 captured_sq = (player_to_move_ == kWhite) ? move.target_sq - kNumFiles
+                                                 : move.target_sq + kNumFiles;
+    Bitboard ep_occupancy =
+        (occupancy ^ (1ULL << move.start_sq) ^ (1ULL << captured_sq)) |
+        (1ULL << move.target_sq);
+    return !(GetAttackersToSq(king_sq, ep_occupancy) & enemy_pieces);
+  }
+
+  // Any other move must capture or block a single checker, and a pinned piece
+  // may only move along the line through its king and pinner.
+  if (checkers) {
+    if (MultipleSetSq(checkers)) {
+      return false;
+    }
+    S8 checker_sq = GetSqOfFirstPiece(checkers);
+    if (!((kBetweenMasks[king_sq][checker_sq] | checkers) &
+          (1ULL << move.target_sq))) {
+      return false;
+    }
+  }
+  return !(pinned_pieces & (1ULL << move.start_sq)) ||
+         static_cast<bool>(kLineMasks[king_sq][move.start_sq] &
+                           (1ULL << move.target_sq));
+}
+
 // Implemement private member functions.
 
 auto Board::GetAttackersToSq(S8 sq, S8 attacked_player) const -> Bitboard {
@@ -555,23 +714,172 @@ auto Board::GetAttackersToSq(S8 sq, S8 attacked_player) const -> Bitboard {
           GetPiecesByType(kKing, attacking_player));
 }
 
-auto Board::EvaluatePiecePositions(Bitboard& white_attackspan,
-                                   Bitboard& white_attack_map,
-                                   Bitboard& white_defender_map,
-                                   Bitboard& black_attackspan,
-                                   Bitboard& black_attack_map,
-                                   Bitboard& black_defender_map) const -> int {
-  // Initialize the attacks and attackspans.
-  white_attackspan = 0X0;
-  white_attack_map = 0X0;
-  white_defender_map = 0X0;
-  black_attackspan = 0X0;
-  black_attack_map = 0X0;
-  black_defender_map = 0X0;
+auto Board::GetAttackersToSq(S8 sq, Bitboard occupancy) const -> Bitboard {
+  if (!SqOnBoard(sq)) {
+    throw invalid_argument("sq in Board::GetAttackersToSq()");
+  }
+
+  // Find pawns of each player that attack sq by looking for pawns that sq
+  // would capture if it held a pawn of the other player.
+  Bitboard pawn_attackers =
+      (kNonSliderAttackMaps[kBlackPawnCapture][sq] & pieces_[kPawn] &
+       player_pieces_[kWhite]) |
+      (kNonSliderAttackMaps[kWhitePawnCapture][sq] & pieces_[kPawn] &
+       player_pieces_[kBlack]);
+  Bitboard diagonal_sliders = pieces_[kBishop] | pieces_[kQueen];
+  Bitboard orthogonal_sliders = pieces_[kRook] | pieces_[kQueen];
+  Bitboard attackers =
+      pawn_attackers |
+      (kNonSliderAttackMaps[kKnightAttack][sq] & pieces_[kKnight]) |
+      (kNonSliderAttackMaps[kKingAttack][sq] & pieces_[kKing]) |
+      (GetSliderAttackMap(sq, kBishopMoves, occupancy) & diagonal_sliders) |
+      (GetSliderAttackMap(sq, kRookMoves, occupancy) & orthogonal_sliders);
+  // Ignore pieces that have been removed from the occupancy.
+  return attackers & occupancy;
+}
+
+auto Board::StaticExchangeEval(const Move& move) const -> int {
+  constexpr int kMaxNumExchanges = 32;
+  int gains[kMaxNumExchanges];
+  S8 target_sq = move.target_sq;
+  Bitboard occupancy = player_pieces_[kWhite] | player_pieces_[kBlack];
+  // Remove the captured pawn of an en passent move, which doesn't lie on the
+  // target square.
+  if (move.is_ep) {
+    S8 captured_pawn_sq =
+        (player_to_move_ == kWhite) ? target_sq - kNumFiles
+                                    : target_sq + kNumFiles;
+    occupancy &= ~(1ULL << captured_pawn_sq);
+  }
+
+  gains[0] = (move.captured_piece == kNA) ? 0 : kPieceVals[move.captured_piece];
+  S8 piece_on_target_sq = move.moving_piece;
+  if (move.promoted_to_piece != kNA) {
+    gains[0] += kPieceVals[move.promoted_to_piece] - kPieceVals[kPawn];
+    piece_on_target_sq = move.promoted_to_piece;
+  }
+
+  Bitboard diagonal_sliders = pieces_[kBishop] | pieces_[kQueen];
+  Bitboard orthogonal_sliders = pieces_[kRook] | pieces_[kQueen];
+  Bitboard attacker = 1ULL << move.start_sq;
+  Bitboard attackers = GetAttackersToSq(target_sq, occupancy);
+  S8 side_to_capture = player_to_move_;
+  int num_exchanges = 0;
+  while (num_exchanges < kMaxNumExchanges - 1) {
+    // Speculatively store the gain of each side recapturing on the target
+    // square with their least valuable attacker.
+    ++num_exchanges;
+    gains[num_exchanges] =
+        kPieceVals[piece_on_target_sq] - gains[num_exchanges - 1];
+    if (max(-gains[num_exchanges - 1], gains[num_exchanges]) < 0) {
+      // Stop once neither side can improve its outcome by continuing.
+      break;
+    }
+
+    // Remove the capturing piece, revealing any sliders behind it (x-rays).
+    occupancy &= ~attacker;
+    attackers |=
+        (GetSliderAttackMap(target_sq, kBishopMoves, occupancy) &
+         diagonal_sliders) |
+        (GetSliderAttackMap(target_sq, kRookMoves, occupancy) &
+         orthogonal_sliders);
+    attackers &= occupancy;
+
+    side_to_capture = GetOtherPlayer(side_to_capture);
+    Bitboard side_attackers = attackers & player_pieces_[side_to_capture];
+    if (side_attackers == 0X0) {
+      break;
+    }
+    for (S8 piece_type = kPawn; piece_type <= kKing; ++piece_type) {
+      Bitboard piece_attackers = side_attackers & pieces_[piece_type];
+      if (piece_attackers) {
+        attacker = 1ULL << GetSqOfFirstPiece(piece_attackers);
+        piece_on_target_sq = piece_type;
+        break;
+      }
+    }
+  }
+
+  // Negamax the speculative gains back to the first capture, letting each
+  // side stop capturing when doing so is favorable.
+  while (--num_exchanges) {
+    gains[num_exchanges - 1] =
+        -max(-gains[num_exchanges - 1], gains[num_exchanges]);
+  }
+  return gains[0];
+}
+
+template <bool kUseDefaultParams>
+auto Board::GetEvalParams() const -> const EvalParams& {
+  if constexpr (kUseDefaultParams) {
+    return kDefaultEvalParams;
+  } else {
+    return *eval_params_;
+  }
+}
+
+template <bool kUseDefaultParams>
+auto Board::EvaluateWithParams() -> int {
+  const EvalParams& eval_params = GetEvalParams<kUseDefaultParams>();
+  int board_score = 0;
+
+  // Count material and add positional bonuses using Piece Square Tables.
+  board_score += EvaluatePiecePositionsWithParams<kUseDefaultParams>();
+
+  // Evaluate pawn structure.
+  int pawn_eval;
+  U64 pawn_hash = GetPawnHash();
+  if (!pawn_table_.Access(pawn_hash, pawn_eval)) {
+    pawn_eval = EvaluatePawnStructureWithParams<kUseDefaultParams>();
+    pawn_table_.Update(pawn_hash, pawn_eval);
+  }
+  board_score += pawn_eval;
+
+  // Evaluate miscelaneous piece bonuses/penalties.
+  S8 player_side;
+  S8 first_sq;
+  Bitboard bishops;
+  Bitboard rooks;
+  for (S8 player = kWhite; player <= kBlack; ++player) {
+    player_side = (player == kWhite) ? 1 : -1;
+
+    // Add a bonus for a bishop pair.
+    bishops = GetPiecesByType(kBishop, player);
+    if (GetNumSetSq(bishops) >= 2) {
+      board_score += (player_side * eval_params.bishop_pair_bonus);
+    }
+
+    // Add a bonus for connected rooks.
+    rooks = GetPiecesByType(kRook, player);
+    if (GetNumSetSq(rooks) >= 2) {
+      first_sq = GetSqOfFirstPiece(rooks);
+      if (static_cast<bool>(GetAttackMap(player, first_sq, kRook) & rooks)) {
+        board_score += (player_side * eval_params.connected_rook_bonus);
+      }
+    }
+
+    // Add a penalty for losing castling rights.
+    if (!castling_status_[player]) {
+      if (!castling_rights_[player][kQueenSide]) {
+        board_score -=
+            (player_side * eval_params.castling_rights_loss_penalty);
+      }
+      if (!castling_rights_[player][kKingSide]) {
+        board_score -=
+            (player_side * eval_params.castling_rights_loss_penalty);
+      }
+    }
+  }
+
+  S8 moving_side = (player_to_move_ == kWhite) ? 1 : -1;
+  return board_score * moving_side;
+}
+
+template <bool kUseDefaultParams>
+auto Board::EvaluatePiecePositionsWithParams() const -> int {
+  const EvalParams& eval_params = GetEvalParams<kUseDefaultParams>();
 
   // Compute phase for tapered evaluation of king position.
-  constexpr int kPiecePhases[kNumPieceTypes - 1] = {0, 1, 1, 2, 4};
-  constexpr int kTotalPhase = 24;
   int phase = kTotalPhase;
   Bitboard pieces;
   for (S8 player = kWhite; player <= kBlack; ++player) {
@@ -580,95 +888,87 @@ auto Board::EvaluatePiecePositions(Bitboard& white_attackspan,
       phase -= (GetNumSetSq(pieces) * kPiecePhases[piece]);
     }
   }
-  constexpr int kPhaseNorm = 256;
   phase = (phase * kPhaseNorm + (kTotalPhase / 2)) / kTotalPhase;
 
-  int material_bonus = 0.0;
-  S8 piece_type;
-  S8 mirror_sq;
-  for (S8 sq = kSqA1; sq <= kSqH8; ++sq) {
-    piece_type = GetPieceOnSq(sq);
-    if (piece_type != kNA) {
-      // Count material and add positional bonuses.
-      if (GetPlayerOnSq(sq) == kWhite) {
-        // Compute the score contribution of a white piece.
-        if (piece_type == kKing) {
-          // Compute the tapered evalution for the king position.
-          material_bonus += kPieceVals[kKing];
-          material_bonus += ((kPieceSqTable[kKing][sq] * (kPhaseNorm - phase) +
-                              kEndgameKingPieceSqTable[sq] * phase) /
-                             kPhaseNorm);
-        } else {
-          material_bonus +=
-              (kPieceVals[piece_type] + kPieceSqTable[piece_type][sq]);
-        }
-
-        if (piece_type == kPawn) {
-          // Compute the contribution to the cummulative white pawn
-          // attackspan, attack map, and defender map.
-          white_attackspan |= kPawnFrontAttackspanMasks[kWhite][sq];
-          white_attack_map |= kNonSliderAttackMaps[kWhitePawnCapture][sq];
-          white_defender_map |= kNonSliderAttackMaps[kBlackPawnCapture][sq];
-        }
-      } else {
-        // Compute the score contribution of a black piece.
-        mirror_sq =
-            GetSqFromRankFile(kRank8 - GetRankFromSq(sq), GetFileFromSq(sq));
-
-        // Compute the score contribution of a black piece.
-        if (piece_type == kKing) {
-          // Compute the tapered evalution for the king position.
-          material_bonus -= kPieceVals[kKing];
-          material_bonus -=
-              ((kPieceSqTable[kKing][mirror_sq] * (kPhaseNorm - phase) +
-                kEndgameKingPieceSqTable[mirror_sq] * phase) /
-               kPhaseNorm);
-        } else {
-          material_bonus -=
-              (kPieceVals[piece_type] + kPieceSqTable[piece_type][mirror_sq]);
-        }
-
-        if (piece_type == kPawn) {
-          // Compute the contribution to the cummulative black pawn
-          // attackspan, attack map, and defender map.
-          black_attackspan |= kPawnFrontAttackspanMasks[kBlack][sq];
-          black_attack_map |= kNonSliderAttackMaps[kBlackPawnCapture][sq];
-          black_defender_map |= kNonSliderAttackMaps[kWhitePawnCapture][sq];
-        }
+  // Visit the pieces of each type through their bitboards, rather than
+  // scanning every square, so that the cost follows the number of pieces.
+  // Black's squares are mirrored vertically to index the tables.
+  int material_bonus = 0;
+  int player_bonus;
+  S8 player_side;
+  S8 mirror_mask;
+  S8 table_sq;
+  S8 king_sq;
+  for (S8 player = kWhite; player <= kBlack; ++player) {
+    player_side = (player == kWhite) ? 1 : -1;
+    mirror_mask = (player == kWhite) ? 0 : kSqA8;
+    player_bonus = 0;
+    for (S8 piece = kPawn; piece <= kQueen; ++piece) {
+      const int* piece_sq_table = eval_params.piece_sq_tables[piece];
+      pieces = GetPiecesByType(piece, player);
+      player_bonus += GetNumSetSq(pieces) * eval_params.piece_vals[piece];
+      while (static_cast<bool>(pieces)) {
+        table_sq = GetSqOfFirstPiece(pieces) ^ mirror_mask;
+        player_bonus += piece_sq_table[table_sq];
+        RemoveFirstPiece(pieces);
       }
     }
+    material_bonus += player_side * player_bonus;
+
+    // Compute the tapered evalution for the king position.
+    king_sq = GetSqOfFirstPiece(GetPiecesByType(kKing, player)) ^ mirror_mask;
+    material_bonus +=
+        player_side *
+        (eval_params.piece_vals[kKing] +
+         (eval_params.piece_sq_tables[kKing][king_sq] * (kPhaseNorm - phase) +
+          eval_params.endgame_king_piece_sq_table[king_sq] * phase) /
+             kPhaseNorm);
   }
   return material_bonus;
 }
 
-auto Board::EvaluatePawnStructure(Bitboard white_attackspan,
-                                  Bitboard white_attack_map,
-                                  Bitboard white_defender_map,
-                                  Bitboard black_attackspan,
-                                  Bitboard black_attack_map,
-                                  Bitboard black_defender_map) const -> int {
-  // Define pawn structure bonuses and penalties.
-  constexpr int kBackwardPawnPenalty = 1;
-  constexpr int kDoubledPawnPenalty = 7;
-  constexpr int kIsolatedPawnPenalty = 2;
-  constexpr int kNeighborBonus = 1;
-  constexpr int kDefenderBonus = 2;
-  constexpr int kRookBehindPassedPawnBonus = 12;
-  constexpr int kPassedPawnBonus[kNumRanks] = {3, 8, 13, 18, 23, 28, 33, 0};
-  constexpr int kKingPawnShieldHolePenalty = 4;
+template <bool kUseDefaultParams>
+auto Board::EvaluatePawnStructureWithParams() const -> int {
+  const EvalParams& eval_params = GetEvalParams<kUseDefaultParams>();
+  const Bitboard white_pawns = GetPiecesByType(kPawn, kWhite);
+  const Bitboard black_pawns = GetPiecesByType(kPawn, kBlack);
+
+  // Compute the squares attacked by each player's pawns, the squares their
+  // pawns could ever attack when advancing, and the squares from which a
+  // pawn of their own would defend them.
+  Bitboard white_attack_map = ShiftEast(white_pawns << kNumFiles) |
+                              ShiftWest(white_pawns << kNumFiles);
+  Bitboard black_attack_map = ShiftEast(black_pawns >> kNumFiles) |
+                              ShiftWest(black_pawns >> kNumFiles);
+  Bitboard white_attackspan = GetNorthFill(white_attack_map);
+  Bitboard black_attackspan = GetSouthFill(black_attack_map);
+  Bitboard white_defender_map = ShiftEast(white_pawns >> kNumFiles) |
+                                ShiftWest(white_pawns >> kNumFiles);
+  Bitboard black_defender_map = ShiftEast(black_pawns << kNumFiles) |
+                                ShiftWest(black_pawns << kNumFiles);
+
+  // Compute the squares behind each player's pawns, from the perspective of
+  // the other player, on their own and neighboring files. A pawn is passed
+  // when it isn't in the other player's such squares.
+  Bitboard white_pawn_files = white_pawns | ShiftEast(white_pawns) |
+                              ShiftWest(white_pawns);
+  Bitboard black_pawn_files = black_pawns | ShiftEast(black_pawns) |
+                              ShiftWest(black_pawns);
+  Bitboard white_blocked_sqs = GetNorthFill(white_pawn_files << kNumFiles);
+  Bitboard black_blocked_sqs = GetSouthFill(black_pawn_files >> kNumFiles);
 
   Bitboard backward_pawns;
   Bitboard defenders;
   Bitboard pawns;
-  Bitboard pawns_on_file;
   Bitboard pawn_stops;
   Bitboard pawns_with_east_neighbor;
-  Bitboard neighor_files;
+  Bitboard doubled_files;
+  Bitboard lone_pawns;
+  Bitboard passed_pawns;
+  Bitboard pawn_file_fill;
   Bitboard king_board;
-  int pawn_eval = 0.0;
+  int pawn_eval = 0;
   S8 player_side;
-  S8 pawn_sq;
-  S8 passer_rank;
   S8 king_sq;
   S8 king_rank;
   S8 king_file;
@@ -677,48 +977,43 @@ auto Board::EvaluatePawnStructure(Bitboard white_attackspan,
   S8 west_pawn_shield_sq;
   S8 pawn_shield_dir;
   for (S8 player = kWhite; player <= kBlack; ++player) {
-    pawns = GetPiecesByType(kPawn, player);
+    pawns = (player == kWhite) ? white_pawns : black_pawns;
     player_side = (player == kWhite) ? 1 : -1;
-    for (S8 file = kFileA; file <= kFileH; ++file) {
-      pawns_on_file = pawns & kFileMasks[file];
-      if (static_cast<bool>(pawns_on_file)) {
-        if (MultipleSetSq(pawns_on_file)) {
-          // Add a penalty for doubled pawns.
-          pawn_eval -= (player_side * kDoubledPawnPenalty);
-        } else {
-          // Determine if a lone pawn on a file is a passer.
-          pawn_sq = GetSqOfFirstPiece(pawns_on_file);
-          if (!static_cast<bool>(
-                  kPawnFrontSpanMasks[player][pawn_sq] &
-                  GetPiecesByType(kPawn, GetOtherPlayer(player)))) {
-            // Add a bonus for passed pawns.
-            passer_rank = GetRankFromSq(pawn_sq);
-            pawn_eval += (player_side * kPassedPawnBonus[passer_rank]);
-
-            // Add a bonus for rooks behind passed pawns.
-            if (static_cast<bool>(GetPiecesByType(kRook, player) &
-                                  kFileMasks[file])) {
-              pawn_eval += (player_side * kRookBehindPassedPawnBonus);
-            }
-          } else {
-            // Compute neighbor file bitmask.
-            neighor_files = 0X0;
-            if (file != kFileA) {
-              neighor_files |= kFileMasks[file - 1];
-            }
-            if (file != kFileH) {
-              neighor_files |= kFileMasks[file + 1];
-            }
-            // Determine if a non-passer pawn is isolated.
-            if (!static_cast<bool>(neighor_files & pawns)) {
-              // Add penalties for isolated pawns that aren't passers.
-              pawn_eval -= (player_side * kIsolatedPawnPenalty);
-            }
-          }
-        }
-      }
+
+    // Add a penalty for each file with doubled pawns, found as the files of
+    // pawns with another pawn in front of them.
+    doubled_files = GetFileFill(pawns & GetSouthFill(pawns >> kNumFiles));
+    pawn_eval -= (player_side *
+                  GetNumSetSq(doubled_files & kRankMasks[kRank1]) *
+                  eval_params.doubled_pawn_penalty);
+
+    // Add bonuses for lone pawns on their files that are passers.
+    lone_pawns = pawns & ~doubled_files;
+    passed_pawns = lone_pawns & ~((player == kWhite) ? black_blocked_sqs
+                                                     : white_blocked_sqs);
+    Bitboard passers_to_score = passed_pawns;
+    while (static_cast<bool>(passers_to_score)) {
+      pawn_eval +=
+          (player_side *
+           eval_params.passed_pawn_bonuses[GetRankFromSq(
+               GetSqOfFirstPiece(passers_to_score))]);
+      RemoveFirstPiece(passers_to_score);
     }
 
+    // Add bonuses for rooks behind passed pawns.
+    pawn_eval += (player_side *
+                  GetNumSetSq(passed_pawns &
+                              GetFileFill(GetPiecesByType(kRook, player))) *
+                  eval_params.rook_behind_passed_pawn_bonus);
+
+    // Add penalties for isolated pawns that aren't passers.
+    pawn_file_fill = GetFileFill(pawns);
+    pawn_eval -=
+        (player_side *
+         GetNumSetSq(lone_pawns & ~passed_pawns &
+                     ~(ShiftEast(pawn_file_fill) | ShiftWest(pawn_file_fill))) *
+         eval_params.isolated_pawn_penalty);
+
     // Add penalties for backward pawns.
     pawn_stops = (player == kWhite)
                      ? GetPiecesByType(kPawn, kWhite) << kNumFiles
@@ -727,22 +1022,23 @@ auto Board::EvaluatePawnStructure(Bitboard white_attackspan,
         (player == kWhite)
             ? (pawn_stops & black_attack_map & ~white_attackspan) >> kNumFiles
             : (pawn_stops & white_attack_map & ~black_attackspan) << kNumFiles;
-    pawn_eval -=
-        (player_side * GetNumSetSq(backward_pawns) * kBackwardPawnPenalty);
+    pawn_eval -= (player_side * GetNumSetSq(backward_pawns) *
+                  eval_params.backward_pawn_penalty);
 
     // Add bonuses for pawns with a east neighbor, which are at least members
     // of a duo.
     pawns_with_east_neighbor = (GetPiecesByType(kPawn, player) >> 1) &
                                GetPiecesByType(kPawn, player) &
                                ~kFileMasks[kFileH];
-    pawn_eval +=
-        (player_side * GetNumSetSq(pawns_with_east_neighbor) * kNeighborBonus);
+    pawn_eval += (player_side * GetNumSetSq(pawns_with_east_neighbor) *
+                  eval_params.neighbor_bonus);
 
     // Add bonuses for defended pawns.
     defenders = (player == kWhite)
                     ? (GetPiecesByType(kPawn, kWhite) & white_defender_map)
                     : (GetPiecesByType(kPawn, kBlack) & black_defender_map);
-    pawn_eval += (player_side * GetNumSetSq(defenders) * kDefenderBonus);
+    pawn_eval += (player_side * GetNumSetSq(defenders) *
+                  eval_params.defender_bonus);
 
     // Add penalties for holes in the pawn shield next to a castled king.
     king_board = GetPiecesByType(kKing, player);
@@ -764,7 +1060,8 @@ auto Board::EvaluatePawnStructure(Bitboard white_attackspan,
             GetSqFromRankFile(king_rank + pawn_shield_dir, king_file - 1);
         if (GetPlayerOnSq(east_pawn_shield_sq) != player ||
             GetPieceOnSq(east_pawn_shield_sq) != kPawn) {
-          pawn_eval -= (player_side * kKingPawnShieldHolePenalty);
+          pawn_eval -=
+              (player_side * eval_params.king_pawn_shield_hole_penalty);
         }
       }
       if (king_file != kFileH) {
@@ -772,20 +1069,140 @@ auto Board::EvaluatePawnStructure(Bitboard white_attackspan,
             GetSqFromRankFile(king_rank + pawn_shield_dir, king_file + 1);
         if (GetPlayerOnSq(west_pawn_shield_sq) != player ||
             GetPieceOnSq(west_pawn_shield_sq) != kPawn) {
-          pawn_eval -= (player_side * kKingPawnShieldHolePenalty);
+          pawn_eval -=
+              (player_side * eval_params.king_pawn_shield_hole_penalty);
         }
       }
       center_pawn_shield_sq =
           GetSqFromRankFile(king_rank + pawn_shield_dir, king_file);
       if (GetPlayerOnSq(center_pawn_shield_sq) != player ||
           GetPieceOnSq(center_pawn_shield_sq) != kPawn) {
-        pawn_eval -= (player_side * kKingPawnShieldHolePenalty);
+        pawn_eval -=
+            (player_side * eval_params.king_pawn_shield_hole_penalty);
       }
     }
   }
   return pawn_eval;
 }
 
+auto Board::PushNnueMove(const Move& move) -> void {
+  ++nnue_ply_;
+  if (nnue_ply_ == static_cast<int>(nnue_stack_.size())) {
+    nnue_stack_.emplace_back();
+  }
+  NnueStackEntry& entry = nnue_stack_[nnue_ply_];
+  entry.accumulator.computed[kWhite] = false;
+  entry.accumulator.computed[kBlack] = false;
+
+  NnueDirtyPiece* dirty_pieces = entry.dirty_pieces;
+  S8 player = player_to_move_;
+  S8 other_player = GetOtherPlayer(player);
+  if (move.castling_type != kNA) {
+    S8 back_rank_sq = (player == kWhite) ? kSqA1 : kSqA8;
+    if (move.castling_type == kQueenSide) {
+      dirty_pieces[0] = {kKing, player, static_cast<S8>(back_rank_sq + kFileE),
+                         static_cast<S8>(back_rank_sq + kFileC)};
+      dirty_pieces[1] = {kRook, player, static_cast<S8>(back_rank_sq + kFileA),
+                         static_cast<S8>(back_rank_sq + kFileD)};
+    } else {
+      dirty_pieces[0] = {kKing, player, static_cast<S8>(back_rank_sq + kFileE),
+                         static_cast<S8>(back_rank_sq + kFileG)};
+      dirty_pieces[1] = {kRook, player, static_cast<S8>(back_rank_sq + kFileH),
+                         static_cast<S8>(back_rank_sq + kFileF)};
+    }
+    entry.num_dirty_pieces = 2;
+    return;
+  }
+
+  int num_dirty_pieces = 0;
+  if (move.promoted_to_piece == kNA) {
+    dirty_pieces[num_dirty_pieces++] = {move.moving_piece, player,
+                                        move.start_sq, move.target_sq};
+  } else {
+    dirty_pieces[num_dirty_pieces++] = {kPawn, player, move.start_sq, kNA};
+    dirty_pieces[num_dirty_pieces++] = {move.promoted_to_piece, player, kNA,
+                                        move.target_sq};
+  }
+  if (move.captured_piece != kNA) {
+    S8 capture_sq = move.target_sq;
+    if (move.is_ep) {
+      capture_sq += (player == kWhite) ? -kNumFiles : kNumFiles;
+    }
+    dirty_pieces[num_dirty_pieces++] = {move.captured_piece, other_player,
+                                        capture_sq, kNA};
+  }
+  entry.num_dirty_pieces = num_dirty_pieces;
+}
+
+auto Board::UpdateNnueAccumulator(S8 perspective) -> void {
+  // Find the closest ply whose accumulator is computed, refreshing instead if
+  // the king of the perspective moved since, which changes every feature.
+  int ply = nnue_ply_;
+  while (!nnue_stack_[ply].accumulator.computed[perspective]) {
+    const NnueStackEntry& entry = nnue_stack_[ply];
+    bool king_moved = ply == 0;
+    for (int dirty_idx = 0; dirty_idx < entry.num_dirty_pieces; ++dirty_idx) {
+      king_moved |= (entry.dirty_pieces[dirty_idx].piece == kKing &&
+                     entry.dirty_pieces[dirty_idx].player == perspective);
+    }
+    if (king_moved) {
+      RefreshNnueAccumulator(perspective);
+      return;
+    }
+    --ply;
+  }
+
+  // Apply the pieces changed by each move since, skipping kings, which aren't
+  // features.
+  S8 king_sq = GetSqOfFirstPiece(GetPiecesByType(kKing, perspective));
+  for (++ply; ply <= nnue_ply_; ++ply) {
+    NnueStackEntry& entry = nnue_stack_[ply];
+    copy(begin(nnue_stack_[ply - 1].accumulator.values[perspective]),
+         end(nnue_stack_[ply - 1].accumulator.values[perspective]),
+         begin(entry.accumulator.values[perspective]));
+    for (int dirty_idx = 0; dirty_idx < entry.num_dirty_pieces; ++dirty_idx) {
+      const NnueDirtyPiece& dirty_piece = entry.dirty_pieces[dirty_idx];
+      if (dirty_piece.piece == kKing) {
+        continue;
+      }
+      if (dirty_piece.from_sq != kNA) {
+        nnue_network_->SubtractFeature(
+            entry.accumulator, perspective,
+            NnueNetwork::GetFeatureIdx(perspective, king_sq, dirty_piece.piece,
+                                       dirty_piece.player,
+                                       dirty_piece.from_sq));
+      }
+      if (dirty_piece.to_sq != kNA) {
+        nnue_network_->AddFeature(
+            entry.accumulator, perspective,
+            NnueNetwork::GetFeatureIdx(perspective, king_sq, dirty_piece.piece,
+                                       dirty_piece.player, dirty_piece.to_sq));
+      }
+    }
+    entry.accumulator.computed[perspective] = true;
+  }
+}
+
+auto Board::RefreshNnueAccumulator(S8 perspective) -> void {
+  NnueAccumulator& accumulator = nnue_stack_[nnue_ply_].accumulator;
+  nnue_network_->ResetAccumulator(accumulator, perspective);
+  S8 king_sq = GetSqOfFirstPiece(GetPiecesByType(kKing, perspective));
+  Bitboard pieces;
+  for (S8 player = kWhite; player <= kBlack; ++player) {
+    for (S8 piece = kPawn; piece <= kQueen; ++piece) {
+      pieces = GetPiecesByType(piece, player);
+      while (static_cast<bool>(pieces)) {
+        nnue_network_->AddFeature(
+            accumulator, perspective,
+            NnueNetwork::GetFeatureIdx(perspective, king_sq, piece, player,
+                                       GetSqOfFirstPiece(pieces)));
+        RemoveFirstPiece(pieces);
+      }
+    }
+  }
+  accumulator.computed[perspective] = true;
+}
+
 auto Board::AddPiece(S8 piece_type, S8 player, S8 sq) -> void {
   if (!SqOnBoard(sq)) {
     throw invalid_argument("sq in Board::AddPiece()");
@@ -811,9 +1228,11 @@ auto Board::InitHash() -> void {
   board_hash_ = 0ULL;
   pawn_hash_ = 0ULL;
 
-  // Initialize the Mersenne Twister 64 bit pseudo-random number generator.
-  U64 seed = std::chrono::system_clock::now().time_since_epoch().count();
-  std::mt19937_64 rand_num_gen(seed);
+  // Initialize the Mersenne Twister 64 bit pseudo-random number generator
+  // with a fixed seed, so that board hashes (and therefore transposition table
+  // collisions) and search results are reproducible between runs.
+  constexpr U64 kZobristSeed = 0X4F6D6567615A65ULL;
+  std::mt19937_64 rand_num_gen(kZobristSeed);
   // Generate a set of random numbers for Zobrist Hashing.
   for (S8 player = kWhite; player < kNumPlayers; ++player) {
     for (S8 board_side = kQueenSide; board_side <= kKingSide; ++board_side) {
@@ -831,17 +1250,22 @@ auto Board::InitHash() -> void {
     S8 ep_target_file = GetFileFromSq(ep_target_sq_);
     board_hash_ ^= ep_file_rand_nums_[ep_target_file];
   }
+  for (S8 player = kWhite; player < kNumPlayers; ++player) {
+    for (S8 piece = kPawn; piece <= kKing; ++piece) {
+      for (S8 sq = kSqA1; sq <= kSqH8; ++sq) {
+        piece_rand_nums_[player][piece][sq] = rand_num_gen();
+      }
+    }
+  }
+  // Update the hash using the current piece placement once all random numbers
+  // for pieces have been generated.
   S8 piece_type;
-  for (S8 piece = kPawn; piece <= kKing; ++piece) {
-    for (S8 sq = kSqA1; sq <= kSqH8; ++sq) {
-      piece_rand_nums_[piece][sq] = rand_num_gen();
-      // Update the hash using the current piece placement.
-      piece_type = piece_layout_[sq];
-      if (piece_type != kNA) {
-        board_hash_ ^= piece_rand_nums_[piece_type][sq];
-        if (piece_type == kPawn) {
-          pawn_hash_ ^= piece_rand_nums_[kPawn][sq];
-        }
+  for (S8 sq = kSqA1; sq <= kSqH8; ++sq) {
+    piece_type = piece_layout_[sq];
+    if (piece_type != kNA) {
+      board_hash_ ^= piece_rand_nums_[player_layout_[sq]][piece_type][sq];
+      if (piece_type == kPawn) {
+        pawn_hash_ ^= piece_rand_nums_[player_layout_[sq]][kPawn][sq];
       }
     }
   }
@@ -850,6 +1274,14 @@ auto Board::InitHash() -> void {
   if (player_to_move_ == kBlack) {
     board_hash_ ^= black_to_move_rand_num_;
   }
+  // Update the hash using whether each player has castled, which the
+  // evaluation rewards.
+  for (S8 player = kWhite; player < kNumPlayers; ++player) {
+    castled_rand_nums_[player] = rand_num_gen();
+    if (castling_status_[player]) {
+      board_hash_ ^= castled_rand_nums_[player];
+    }
+  }
 }
 
 auto Board::InitBoardPos(const std::string& init_pos) -> void {
@@ -1003,6 +1435,10 @@ auto Board::InitBoardPos(const std::string& init_pos) -> void {
   if (!white_king_added || !black_king_added) {
     throw invalid_argument("board initialization FEN string");
   }
+  // Start the halfmove clock at zero if the FEN string doesn't specify it.
+  if (halfmove_clock_ == kNA) {
+    halfmove_clock_ = 0;
+  }
 }
 
 auto Board::MakeNonCastlingMove(const Move& move) -> void {
@@ -1027,17 +1463,18 @@ auto Board::MakeNonCastlingMove(const Move& move) -> void {
       pieces_[kPawn] &= ep_capture_mask;
       player_pieces_[other_player] &= ep_capture_mask;
       // Update the board hash to reflect piece removal.
-      board_hash_ ^= piece_rand_nums_[kPawn][ep_capture_sq];
-      pawn_hash_ ^= piece_rand_nums_[kPawn][ep_capture_sq];
+      board_hash_ ^= piece_rand_nums_[other_player][kPawn][ep_capture_sq];
+      pawn_hash_ ^= piece_rand_nums_[other_player][kPawn][ep_capture_sq];
     } else {
       // Remove the captured piece from the board.
       Bitboard piece_capture_mask = ~(1ULL << move.target_sq);
       pieces_[move.captured_piece] &= piece_capture_mask;
       player_pieces_[other_player] &= piece_capture_mask;
       // Update the board hash to reflect piece removal.
-      board_hash_ ^= piece_rand_nums_[move.captured_piece][move.target_sq];
+      board_hash_ ^=
+          piece_rand_nums_[other_player][move.captured_piece][move.target_sq];
       if (move.captured_piece == kPawn) {
-        pawn_hash_ ^= piece_rand_nums_[kPawn][move.target_sq];
+        pawn_hash_ ^= piece_rand_nums_[other_player][kPawn][move.target_sq];
       }
     }
   }
@@ -1066,9 +1503,9 @@ auto Board::MovePiece(S8 piece, S8 start_sq, S8 target_sq, S8 promoted_to_piece)
   pieces_[piece] &= rm_piece_mask;
   player_pieces_[player_to_move_] &= rm_piece_mask;
   // Update the board hash to reflect piece removal.
-  board_hash_ ^= piece_rand_nums_[piece][start_sq];
+  board_hash_ ^= piece_rand_nums_[player_to_move_][piece][start_sq];
   if (piece == kPawn) {
-    pawn_hash_ ^= piece_rand_nums_[kPawn][start_sq];
+    pawn_hash_ ^= piece_rand_nums_[player_to_move_][kPawn][start_sq];
   }
 
   // Add the selected piece back at its target position on the board and
@@ -1077,16 +1514,17 @@ auto Board::MovePiece(S8 piece, S8 start_sq, S8 target_sq, S8 promoted_to_piece)
   if (promoted_to_piece == kNA) {
     pieces_[piece] |= new_piece_pos_mask;
     piece_layout_[target_sq] = piece;
-    board_hash_ ^= piece_rand_nums_[piece][target_sq];
+    board_hash_ ^= piece_rand_nums_[player_to_move_][piece][target_sq];
     if (piece == kPawn) {
-      pawn_hash_ ^= piece_rand_nums_[kPawn][target_sq];
+      pawn_hash_ ^= piece_rand_nums_[player_to_move_][kPawn][target_sq];
     }
   } else {
     // Add a piece back as the type it promotes to if move is a pawn
     // promotion.
     pieces_[promoted_to_piece] |= new_piece_pos_mask;
     piece_layout_[target_sq] = promoted_to_piece;
-    board_hash_ ^= piece_rand_nums_[promoted_to_piece][target_sq];
+    board_hash_ ^=
+        piece_rand_nums_[player_to_move_][promoted_to_piece][target_sq];
   }
 
   player_layout_[target_sq] = player_to_move_;
@@ -1106,7 +1544,8 @@ auto Board::UnmakeNonCastlingMove(const Move& move) -> void {
     piece_layout_[move.target_sq] = kNA;
     player_layout_[move.target_sq] = kNA;
     // Update the board hash to reflect piece removal.
-    board_hash_ ^= piece_rand_nums_[move.promoted_to_piece][move.target_sq];
+    board_hash_ ^= piece_rand_nums_[player_to_move_][move.promoted_to_piece]
+                                   [move.target_sq];
 
     // Add the original pawn back to its start position.
     Bitboard og_piece_pos_mask = 1ULL << move.start_sq;
@@ -1115,8 +1554,8 @@ auto Board::UnmakeNonCastlingMove(const Move& move) -> void {
     piece_layout_[move.start_sq] = kPawn;
     player_layout_[move.start_sq] = player_to_move_;
     // Update the board hash to reflect piece addition.
-    board_hash_ ^= piece_rand_nums_[kPawn][move.start_sq];
-    pawn_hash_ ^= piece_rand_nums_[kPawn][move.start_sq];
+    board_hash_ ^= piece_rand_nums_[player_to_move_][kPawn][move.start_sq];
+    pawn_hash_ ^= piece_rand_nums_[player_to_move_][kPawn][move.start_sq];
   }
 
   // Place a captured piece back onto the board.
@@ -1139,8 +1578,8 @@ auto Board::UnmakeNonCastlingMove(const Move& move) -> void {
       pieces_[kPawn] |= undo_ep_capture_mask;
       player_pieces_[other_player] |= undo_ep_capture_mask;
       // Update the board hash to reflect piece addition.
-      board_hash_ ^= piece_rand_nums_[kPawn][ep_capture_sq];
-      pawn_hash_ ^= piece_rand_nums_[kPawn][ep_capture_sq];
+      board_hash_ ^= piece_rand_nums_[other_player][kPawn][ep_capture_sq];
+      pawn_hash_ ^= piece_rand_nums_[other_player][kPawn][ep_capture_sq];
     } else {
       Bitboard undo_capture_mask = 1ULL << move.target_sq;
       // Add the captured piece back to its original position.
@@ -1149,9 +1588,10 @@ auto Board::UnmakeNonCastlingMove(const Move& move) -> void {
       piece_layout_[move.target_sq] = move.captured_piece;
       player_layout_[move.target_sq] = other_player;
       // Update the board hash to reflect piece addition.
-      board_hash_ ^= piece_rand_nums_[move.captured_piece][move.target_sq];
+      board_hash_ ^=
+          piece_rand_nums_[other_player][move.captured_piece][move.target_sq];
       if (move.captured_piece == kPawn) {
-        pawn_hash_ ^= piece_rand_nums_[kPawn][move.target_sq];
+        pawn_hash_ ^= piece_rand_nums_[other_player][kPawn][move.target_sq];
       }
     }
   }
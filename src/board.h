@@ -14,8 +14,11 @@
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
+#include "eval_cache.h"
 #include "move.h"
+#include "nnue.h"
 #include "pawn_table.h"
 
 namespace omegazero {
@@ -24,7 +27,6 @@ using std::invalid_argument;
 using std::stack;
 
 typedef uint64_t Bitboard;
-typedef uint64_t U64;
 
 enum BoardSide : S8 { kQueenSide, kKingSide };
 enum File : S8 {
@@ -100,10 +102,19 @@ constexpr S8 kNumRanks = 8;
 constexpr S8 kNumSliderMaps = 2;
 constexpr S8 kNumSq = 64;
 
-// Store piece values expressed in centipawns for evaluation function. Piece
-// order in array is pawn, knight, bishop, rook, queen, king.
+// Store piece values expressed in centipawns for the search and static
+// exchange evaluation. The evaluation function reads its own piece values from
+// its EvalParams. Piece order in array is pawn, knight, bishop, rook, queen,
+// king.
 constexpr int kPieceVals[kNumPieceTypes] = {100, 320, 330, 500, 900, 20000};
 
+// Store how much each piece type, excluding the king, contributes to the game
+// phase used to taper the evaluation of the king's position from the
+// middlegame to the endgame. The phase is scaled to the range [0, kPhaseNorm].
+constexpr int kPiecePhases[kNumPieceTypes - 1] = {0, 1, 1, 2, 4};
+constexpr int kTotalPhase = 24;
+constexpr int kPhaseNorm = 256;
+
 constexpr Bitboard kFileMasks[kNumFiles] = {
     0X0101010101010101, 0X0202020202020202, 0X0404040404040404,
     0X0808080808080808, 0X1010101010101010, 0X2020202020202020,
@@ -138,9 +149,14 @@ extern const Bitboard kSliderPieceMaps[kNumSliderMaps][kNumSq];
 extern const Bitboard kUnblockedSliderAttackMaps[kNumSliderMaps][kNumSq];
 extern const Bitboard kPawnFrontAttackspanMasks[kNumPlayers][kNumSq];
 extern const Bitboard kPawnFrontSpanMasks[kNumPlayers][kNumSq];
-
-extern const int kPieceSqTable[kNumPieceTypes][kNumSq];
-extern const int kEndgameKingPieceSqTable[kNumSq];
+// Store all positions a queen can move to on an empty board, including
+// endpoints, for finding the pieces aligned with a king.
+extern const Bitboard kQueenRayMasks[kNumSq];
+// Store the squares strictly between two squares sharing a rank, file or
+// diagonal, and the full line through both squares from edge to edge. Both
+// are empty for squares that aren't aligned.
+extern const Bitboard kBetweenMasks[kNumSq][kNumSq];
+extern const Bitboard kLineMasks[kNumSq][kNumSq];
 
 extern const U64 kMagics[kNumSliderMaps][kNumSq];
 
@@ -158,10 +174,24 @@ auto GetFileFromSq(S8 sq) -> S8;
 auto GetRankFromSq(S8 sq) -> S8;
 auto GetSqFromRankFile(S8 rank, S8 file) -> S8;
 auto GetSqOfFirstPiece(Bitboard board) -> S8;
+// Shift every square of a bitboard one file east or west, dropping squares
+// shifted off the board.
+auto ShiftEast(Bitboard board) -> Bitboard;
+auto ShiftWest(Bitboard board) -> Bitboard;
+// Return the squares on or in front of (north of or south of) the set squares
+// of a bitboard, or every square on their files.
+auto GetNorthFill(Bitboard board) -> Bitboard;
+auto GetSouthFill(Bitboard board) -> Bitboard;
+auto GetFileFill(Bitboard board) -> Bitboard;
+// Return the attacks of a bishop or rook on sq given a board occupancy.
+auto GetSliderAttackMap(S8 sq, S8 slider_map_index, Bitboard occupancy)
+    -> Bitboard;
 
 // Clear the least significant bit set of the passed in bitboard.
 auto RemoveFirstSq(Bitboard& board) -> void;
 
+struct EvalParams;
+
 class Board {
  public:
   Board(const std::string& init_pos);
@@ -171,17 +201,47 @@ class Board {
   // Return possible attacks a specified piece can make on all other pieces.
   auto GetAttackMap(S8 attacking_player, S8 sq, S8 attacking_piece) const
       -> Bitboard;
+  // Return the pieces of both players that attack a square, treating only the
+  // squares in the occupancy as occupied. Sliders behind pieces removed from
+  // the occupancy are included, allowing x-ray attacks to be found.
+  auto GetAttackersToSq(S8 sq, Bitboard occupancy) const -> Bitboard;
   auto GetPiecesByType(S8 piece_type, S8 player) const -> Bitboard;
 
   auto CastlingLegal(S8 board_side) const -> bool;
   auto DoublePawnPushLegal(S8 file) const -> bool;
+  // Return if either player may still castle on either side of the board.
+  auto HasCastlingRights() const -> bool;
+  // Return if a player has already castled.
+  auto HasCastled(S8 player) const -> bool;
   auto KingInCheck() const -> bool;
+  // Return the enemy pieces giving check to the player to move.
+  auto GetCheckers() const -> Bitboard;
+  // Return the pieces of a player that are pinned to their king by an enemy
+  // slider.
+  auto GetPinnedPieces(S8 player) const -> Bitboard;
+  // Return if a pseudo-legal move of the player to move leaves their king out
+  // of check, without making the move. The player's pinned pieces and the
+  // pieces checking them are passed in so that they're computed once for all
+  // moves of a position.
+  auto MoveLegal(const Move& move, Bitboard pinned_pieces,
+                 Bitboard checkers) const -> bool;
 
   // Compute and return a static evaluation of the board state. This score is
   // relative to the side being evaluated and symmetric, as required by the
   // Negamax Algorithm.
   auto Evaluate() -> int;
-
+  // Compute the material and piece square term and the pawn structure term of
+  // Evaluate() from white's perspective. The pawn structure is computed
+  // directly, bypassing the pawn table.
+  auto EvaluatePiecePositions() const -> int;
+  auto EvaluatePawnStructure() const -> int;
+  // Compute the material the moving player gains from a capture once all
+  // recaptures on the target square are resolved using Static Exchange
+  // Evaluation.
+  auto StaticExchangeEval(const Move& move) const -> int;
+
+  // Return if a player may still castle on a side of the board.
+  auto GetCastlingRight(S8 player, S8 board_side) const -> bool;
   auto GetEpTargetSq() const -> S8;
   auto GetHalfmoveClock() const -> S8;
   auto GetPieceOnSq(S8 sq) const -> S8;
@@ -190,8 +250,29 @@ class Board {
 
   // Return an (almost) unique hash that represents the current board state.
   auto GetBoardHash() const -> U64;
-
+  // Return the board hash of the position a move leads to without making the
+  // move, and store the pawn hash of that position in child_pawn_hash. Changes
+  // to castling rights aren't accounted for, since the hash is only used to
+  // prefetch table entries.
+  auto GetChildHash(const Move& move, U64& child_pawn_hash) const -> U64;
+  // Start loading the pawn table entry for the given pawn hash into the
+  // cache, unless it is the entry of the current pawn structure, which is
+  // already cached.
+  auto PrefetchPawnEntry(U64 pawn_hash) const -> void;
+
+  // Evaluate positions with the given weights, or with the default weights if
+  // eval_params is null. The weights must outlive the board.
+  auto SetEvalParams(const EvalParams* eval_params) -> void;
+  // Evaluate positions with the given NNUE network instead of the hand-crafted
+  // evaluation, or with the hand-crafted evaluation if nnue_network is null.
+  // The network must outlive the board.
+  auto SetNnueNetwork(const NnueNetwork* nnue_network) -> void;
   auto ClearPawnTable() -> void;
+  auto GetPawnTable() const -> const PawnTable&;
+  auto ResetPawnTableStats() -> void;
+  auto ClearEvalCache() -> void;
+  auto GetEvalCache() const -> const EvalCache&;
+  auto ResetEvalCacheStats() -> void;
   // Resets information edited during search after a search is interrupted
   // during iterative deepening.
   // WARNING: Calling this function without first calling SavePos() will cause
@@ -200,6 +281,9 @@ class Board {
   // Caches a copy of information edited during search before iterative
   // deepening, allowing ResetPos() to be called after iterative deepening.
   auto SavePos() -> void;
+  // Set up a new position from a FEN string, discarding the current position
+  // and its move history.
+  auto SetPos(const std::string& init_pos) -> void;
   auto SwitchPlayer() -> void;
   auto MakeMove(const Move& move) -> void;
   auto MakeNullMove() -> void;
@@ -215,20 +299,28 @@ class Board {
  private:
   auto GetAttackersToSq(S8 sq, S8 attacked_player) const -> Bitboard;
 
-  // Weighs material balance and positional bonuses and computes the white and
-  // black pawn cummulative front attackspans for evaluating pawn structure.
-  auto EvaluatePiecePositions(Bitboard& white_attackspan,
-                              Bitboard& white_attack_map,
-                              Bitboard& white_defender_map,
-                              Bitboard& black_attackspan,
-                              Bitboard& black_attack_map,
-                              Bitboard& black_defender_map) const -> int;
-  auto EvaluatePawnStructure(Bitboard white_attackspan,
-                             Bitboard white_attack_map,
-                             Bitboard white_defender_map,
-                             Bitboard black_attackspan,
-                             Bitboard black_attack_map,
-                             Bitboard black_defender_map) const -> int;
+  // Return the weights used by the evaluation. When kUseDefaultParams is set,
+  // these are the compile time constants in kDefaultEvalParams, which lets the
+  // compiler fold them into the default evaluation.
+  template <bool kUseDefaultParams>
+  auto GetEvalParams() const -> const EvalParams&;
+  template <bool kUseDefaultParams>
+  auto EvaluateWithParams() -> int;
+  // Weighs material balance and positional bonuses.
+  template <bool kUseDefaultParams>
+  auto EvaluatePiecePositionsWithParams() const -> int;
+  template <bool kUseDefaultParams>
+  auto EvaluatePawnStructureWithParams() const -> int;
+
+  // Push the accumulator of the position after a move onto the NNUE stack,
+  // recording the pieces the move changes.
+  auto PushNnueMove(const Move& move) -> void;
+  // Bring the accumulator of the current ply up to date for a player's
+  // perspective, either by applying the changes made since the closest ply
+  // with a computed accumulator or, if that player's king has moved since, by
+  // recomputing it from every piece.
+  auto UpdateNnueAccumulator(S8 perspective) -> void;
+  auto RefreshNnueAccumulator(S8 perspective) -> void;
 
   // Get a hash of the current pawn structure;
   auto GetPawnHash() const -> U64;
@@ -267,6 +359,8 @@ class Board {
 
     U64 board_hash;
     U64 pawn_hash;
+
+    int nnue_ply;
   } saved_pos_info_;
 
   // Store bitboard board representations of each type
@@ -280,6 +374,14 @@ class Board {
   bool castling_status_[kNumPlayers];
 
   PawnTable pawn_table_;
+  EvalCache eval_cache_;
+  const EvalParams* eval_params_;
+
+  const NnueNetwork* nnue_network_;
+  // Store the NNUE accumulators of the positions reached by the moves made
+  // since the position was set, indexed by ply.
+  vector<NnueStackEntry> nnue_stack_;
+  int nnue_ply_;
 
   // Keep track of the square (if it exists) an en passent move is elligible
   // to land on during a given turn.
@@ -305,8 +407,9 @@ class Board {
   U64 pawn_hash_;
   U64 castling_rights_rand_nums_[kNumPlayers][kNumBoardSides];
   U64 ep_file_rand_nums_[kNumFiles];
-  U64 piece_rand_nums_[kNumPieceTypes][kNumSq];
+  U64 piece_rand_nums_[kNumPlayers][kNumPieceTypes][kNumSq];
   U64 black_to_move_rand_num_;
+  U64 castled_rand_nums_[kNumPlayers];
 };
 
 // Implement public inline non-member functions.
@@ -398,16 +501,62 @@ inline auto GetSqOfFirstPiece(Bitboard board) -> S8 {
 
 inline auto RemoveFirstPiece(Bitboard& board) -> void { board &= (board - 1); }
 
+inline auto ShiftEast(Bitboard board) -> Bitboard {
+  return (board << 1) & ~kFileMasks[kFileA];
+}
+
+inline auto ShiftWest(Bitboard board) -> Bitboard {
+  return (board >> 1) & ~kFileMasks[kFileH];
+}
+
+inline auto GetNorthFill(Bitboard board) -> Bitboard {
+  // Use a Kogge-Stone fill, doubling the filled distance with each step.
+  board |= (board << kNumFiles);
+  board |= (board << (2 * kNumFiles));
+  board |= (board << (4 * kNumFiles));
+  return board;
+}
+
+inline auto GetSouthFill(Bitboard board) -> Bitboard {
+  board |= (board >> kNumFiles);
+  board |= (board >> (2 * kNumFiles));
+  board |= (board >> (4 * kNumFiles));
+  return board;
+}
+
+inline auto GetFileFill(Bitboard board) -> Bitboard {
+  return GetNorthFill(board) | GetSouthFill(board);
+}
+
 // Implement inline member functions.
 
 inline auto Board::operator==(const Board& rhs) const -> bool {
   return GetBoardHash() == rhs.GetBoardHash();
 }
 
+inline auto Board::HasCastled(S8 player) const -> bool {
+  return castling_status_[player];
+}
+
 inline auto Board::KingInCheck() const -> bool {
+  return static_cast<bool>(GetCheckers());
+}
+
+inline auto Board::GetCheckers() const -> Bitboard {
   Bitboard king_board = pieces_[kKing] & player_pieces_[player_to_move_];
   S8 king_sq = GetSqOfFirstPiece(king_board);
-  return static_cast<bool>(GetAttackersToSq(king_sq, player_to_move_));
+  return GetAttackersToSq(king_sq, player_to_move_);
+}
+
+inline auto Board::HasCastlingRights() const -> bool {
+  return castling_rights_[kWhite][kQueenSide] ||
+         castling_rights_[kWhite][kKingSide] ||
+         castling_rights_[kBlack][kQueenSide] ||
+         castling_rights_[kBlack][kKingSide];
+}
+
+inline auto Board::GetCastlingRight(S8 player, S8 board_side) const -> bool {
+  return castling_rights_[player][board_side];
 }
 
 inline auto Board::GetEpTargetSq() const -> S8 { return ep_target_sq_; }
@@ -430,8 +579,37 @@ inline auto Board::GetPlayerToMove() const -> S8 { return player_to_move_; }
 
 inline auto Board::GetBoardHash() const -> U64 { return board_hash_; }
 
+inline auto Board::SetEvalParams(const EvalParams* eval_params) -> void {
+  eval_params_ = eval_params;
+  // Cached pawn structure and position evaluations depend on the weights.
+  pawn_table_.Clear();
+  eval_cache_.Clear();
+}
+
+inline auto Board::SetNnueNetwork(const NnueNetwork* nnue_network) -> void {
+  nnue_network_ = nnue_network;
+  nnue_ply_ = 0;
+  nnue_stack_[0].accumulator.computed[kWhite] = false;
+  nnue_stack_[0].accumulator.computed[kBlack] = false;
+  eval_cache_.Clear();
+}
+
 inline auto Board::ClearPawnTable() -> void { pawn_table_.Clear(); }
 
+inline auto Board::GetPawnTable() const -> const PawnTable& {
+  return pawn_table_;
+}
+
+inline auto Board::ResetPawnTableStats() -> void { pawn_table_.ResetStats(); }
+
+inline auto Board::ClearEvalCache() -> void { eval_cache_.Clear(); }
+
+inline auto Board::GetEvalCache() const -> const EvalCache& {
+  return eval_cache_;
+}
+
+inline auto Board::ResetEvalCacheStats() -> void { eval_cache_.ResetStats(); }
+
 inline auto Board::SwitchPlayer() -> void {
   player_to_move_ = (player_to_move_ == kWhite) ? kBlack : kWhite;
   // Update the board hash to reflect player turnover.
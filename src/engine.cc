@@ -8,10 +8,12 @@
 #include "engine.h"
 
 #include <algorithm>
+#include <array>
 #include <chrono>
 #include <cmath>
 #include <cstdint>
-#include <queue>
+#include <cstdlib>
+#include <limits>
 #include <stdexcept>
 #include <unordered_map>
 #include <utility>
@@ -26,12 +28,13 @@
 
 namespace omegazero {
 
+using std::array;
+using std::count_if;
+using std::fill;
 using std::max;
 using std::min;
-using std::pair;
-using std::queue;
+using std::none_of;
 using std::runtime_error;
-using std::sort;
 using std::unordered_map;
 using std::vector;
 using std::chrono::high_resolution_clock;
@@ -41,10 +44,86 @@ using std::chrono::high_resolution_clock;
 constexpr int kAggressorSortVals[kNumPieceTypes] = {-1, -2, -3, -4, -5, -6};
 constexpr int kVictimSortVals[kNumPieceTypes] = {10, 20, 30, 40, 50, 60};
 
+namespace {
+
+// Store the most legal moves possible in any position, and a bound on the
+// number of moves which indexes the Late Move Reduction table. The table is
+// indexed by the number of legal moves searched, so it must cover the most
+// legal moves.
+constexpr int kMaxNumLegalMoves = 218;
+constexpr int kMaxNumMoves = 256;
+static_assert(kMaxNumMoves > kMaxNumLegalMoves,
+              "The Late Move Reduction table must cover every legal move");
+
+typedef array<array<S8, kMaxNumMoves>, kSearchLimit + 1> LmrTable;
+
+// Compute the depth reduction of Late Move Reduction for each remaining depth
+// and move index using the formula from Fruit,
+// int(sqrt(depth - 1) + sqrt(move_idx - 1)).
+auto ComputeLmrReductions() -> LmrTable {
+  LmrTable reductions;
+  for (int depth = 0; depth <= kSearchLimit; ++depth) {
+    for (int move_idx = 0; move_idx < kMaxNumMoves; ++move_idx) {
+      reductions[depth][move_idx] = static_cast<S8>(
+          depth < 1 || move_idx < 1
+              ? 0
+              : sqrt(static_cast<double>(depth - 1)) +
+                    sqrt(static_cast<double>(move_idx - 1)));
+    }
+  }
+  return reductions;
+}
+
+const LmrTable kLmrReductions = ComputeLmrReductions();
+
+// Store the move ordering score of each class of move. Classes are spaced
+// further apart than the MVV-LVA and history scores added within them, so
+// that those only order moves of the same class.
+constexpr int kMoveScoreClassSize = 1 << 16;
+constexpr int kLosingCaptureScore = 0;
+constexpr int kSilentMoveScore = 2 * kMoveScoreClassSize;
+constexpr int kCounterMoveScore = 3 * kMoveScoreClassSize;
+constexpr int kKillerMoveScore = 4 * kMoveScoreClassSize;
+constexpr int kCaptureScore = 5 * kMoveScoreClassSize;
+constexpr int kHashMoveScore = 6 * kMoveScoreClassSize;
+constexpr int kPvMoveScore = 7 * kMoveScoreClassSize;
+static_assert(kMaxHistoryScore < kMoveScoreClassSize,
+              "History scores must not overlap other classes of moves");
+
+// Sort moves by descending score in place, keeping moves with equal scores in
+// the order they were generated. Move lists are short, so an insertion sort
+// is used, which unlike stable_sort() never allocates.
+auto SortMovesByScore(vector<Move>& move_list, vector<int>& move_scores)
+    -> void {
+  for (size_t move_idx = 1; move_idx < move_list.size(); ++move_idx) {
+    Move move = move_list[move_idx];
+    int score = move_scores[move_idx];
+    size_t insert_idx = move_idx;
+    for (; insert_idx > 0 && move_scores[insert_idx - 1] < score;
+         --insert_idx) {
+      move_list[insert_idx] = move_list[insert_idx - 1];
+      move_scores[insert_idx] = move_scores[insert_idx - 1];
+    }
+    move_list[insert_idx] = move;
+    move_scores[insert_idx] = score;
+  }
+}
+
+}  // namespace
+
 // Implement public member functions.
 
-Engine::Engine(Board* board, S8 player_side, float search_time) {
+Engine::Engine(Board* board, S8 player_side, float search_time,
+               const SearchOptions& search_options)
+    : transposition_table_(search_options.hash_size_mb) {
   board_ = board;
+  search_options_ = search_options;
+  board_->SetEvalParams(search_options_.eval_params);
+  board_->SetNnueNetwork(search_options_.nnue_network);
+  node_count_ = 0;
+  search_eval_ = 0;
+  search_depth_ = 0;
+  NewPosition();
 
   constexpr float kMinSearchTime = 0.1f;
   if (search_time < kMinSearchTime) {
@@ -68,38 +147,74 @@ Engine::Engine(Board* board, S8 player_side, float search_time) {
 auto Engine::GetBestMove() -> Move {
   transposition_table_.Clear();
   board_->ClearPawnTable();
+  board_->ClearEvalCache();
+  node_count_ = 0;
+  stats_.Clear();
+  prev_iteration_nodes_ = 0;
+  board_->ResetPawnTableStats();
+  board_->ResetEvalCacheStats();
+  AgeHistoryScores();
+  principal_variation_.clear();
   Move best_move;
+  if (GetTablebaseMove(best_move)) {
+    search_depth_ = 0;
+    principal_variation_.push_back(best_move);
+    if (search_options_.verbose) {
+      cout << "SEARCH DEPTH: 0 (TABLEBASE)" << endl;
+    }
+    return best_move;
+  }
   Move move;
   board_->SavePos();
+  // Save the length of the position history, since a search stopped by
+  // OutOfTime leaves the positions of the abandoned line in it.
+  size_t game_history_size = pos_history_.size();
   constexpr int kRootNodePly = 0;
-  // Initialize the first guess for the MTD(f) algorithm, f, with a search to
-  // a depth of one.
-  int f = MtdfSearch(0, 1, kRootNodePly, best_move);
+  // Initialize the first guess for the root search, f, with a search to a
+  // depth of one.
+  int f = RootSearch(0, 1, kRootNodePly, best_move);
+  UpdatePrincipalVariation(1, f);
+  OutputStats(1);
 
-  // Perform an MTD(f) search inside an iterative deepening framework.
+  // Perform the root search inside an iterative deepening framework.
   search_start_ = high_resolution_clock::now();
+  int max_search_depth = (search_options_.depth_limit > 0)
+                             ? min(search_options_.depth_limit, kSearchLimit)
+                             : kSearchLimit;
   int search_depth = 2;
-  for (; search_depth <= kSearchLimit; ++search_depth) {
+  for (; search_depth <= max_search_depth; ++search_depth) {
     try {
-      f = MtdfSearch(f, search_depth, kRootNodePly, move);
+      f = RootSearch(f, search_depth, kRootNodePly, move);
       if (move.moving_piece != kNA || move.castling_type != kNA) {
         best_move = move;
+        UpdatePrincipalVariation(search_depth, f);
       }
+      OutputStats(search_depth);
     } catch (OutOfTime& e) {
       break;
     }
   }
 
-  search_depth =
-      (search_depth == kSearchLimit) ? kSearchLimit : search_depth - 1;
-  cout << "SEARCH DEPTH: " << search_depth << endl;
+  search_depth = min(search_depth - 1, max_search_depth);
+  search_eval_ = f;
+  search_depth_ = search_depth;
+  if (search_options_.verbose) {
+    cout << "SEARCH DEPTH: " << search_depth << endl;
+  }
   board_->ResetPos();
+  pos_history_.resize(game_history_size);
   return best_move;
 }
 
 auto Engine::GetGameStatus() -> S8 {
   // Check for checks, checkmates, and draws.
-  vector<Move> move_list = GenerateMoves();
+  Bitboard checkers = board_->GetCheckers();
+  vector<Move> move_list;
+  if (checkers) {
+    GenerateEvasions(move_list, checkers);
+  } else {
+    GenerateMoves(move_list);
+  }
   bool no_legal_moves = true;
   for (const Move& move : move_list) {
     try {
@@ -113,7 +228,7 @@ auto Engine::GetGameStatus() -> S8 {
     break;
   }
 
-  if (board_->KingInCheck()) {
+  if (checkers) {
     string player_name = GetPlayerStr(board_->GetPlayerToMove());
     if (no_legal_moves) {
       return kPlayerCheckmated;
@@ -138,9 +253,26 @@ auto Engine::Perft(int depth) -> U64 {
     return 1ULL;
   }
 
+  Bitboard checkers = board_->GetCheckers();
+  vector<Move> move_list;
+  if (checkers) {
+    GenerateEvasions(move_list, checkers);
+  } else {
+    GenerateMoves(move_list);
+  }
+  if (depth == 1) {
+    // Count the legal moves of the last ply in bulk rather than making and
+    // unmaking each one.
+    Bitboard pinned_pieces =
+        board_->GetPinnedPieces(board_->GetPlayerToMove());
+    return static_cast<U64>(
+        count_if(move_list.begin(), move_list.end(), [&](const Move& move) {
+          return board_->MoveLegal(move, pinned_pieces, checkers);
+        }));
+  }
+
   // Traverse a game tree of chess positions recursively to count leaf nodes.
   U64 node_count = 0;
-  vector<Move> move_list = GenerateMoves();
   for (Move& move : move_list) {
     try {
       board_->MakeMove(move);
@@ -154,14 +286,65 @@ auto Engine::Perft(int depth) -> U64 {
   return node_count;
 }
 
+auto Engine::Perft(int depth, PerftCounts& counts) -> void {
+  if (depth == 0) {
+    ++counts.nodes;
+    return;
+  }
+
+  Bitboard checkers = board_->GetCheckers();
+  vector<Move> move_list;
+  if (checkers) {
+    GenerateEvasions(move_list, checkers);
+  } else {
+    GenerateMoves(move_list);
+  }
+  for (Move& move : move_list) {
+    try {
+      board_->MakeMove(move);
+    } catch (BadMove& e) {
+      // Ignore all moves that put the player's king in check.
+      continue;
+    }
+    if (depth == 1) {
+      counts.captures += (move.captured_piece != kNA);
+      counts.eps += move.is_ep;
+      counts.castles += (move.castling_type != kNA);
+      counts.promotions += (move.promoted_to_piece != kNA);
+      if (board_->KingInCheck()) {
+        ++counts.checks;
+        // The position is checkmate if no reply escapes the check.
+        Bitboard reply_checkers = board_->GetCheckers();
+        vector<Move> replies;
+        GenerateEvasions(replies, reply_checkers);
+        Bitboard pinned_pieces =
+            board_->GetPinnedPieces(board_->GetPlayerToMove());
+        counts.checkmates +=
+            none_of(replies.begin(), replies.end(), [&](const Move& reply) {
+              return board_->MoveLegal(reply, pinned_pieces, reply_checkers);
+            });
+      }
+    }
+    Perft(depth - 1, counts);
+    board_->UnmakeMove(move);
+  }
+}
+
 auto Engine::GenerateMoves(bool captures_only) const -> vector<Move> {
+  vector<Move> move_list;
+  GenerateMoves(move_list, captures_only);
+  return move_list;
+}
+
+auto Engine::GenerateMoves(vector<Move>& move_list, bool captures_only) const
+    -> void {
   S8 moving_piece;
   S8 moving_player = board_->GetPlayerToMove();
   S8 enemy_player = GetOtherPlayer(moving_player);
   S8 start_sq;
   Bitboard moving_pieces = board_->GetPiecesByType(kNA, moving_player);
   Bitboard remove_bad_sqs_mask;
-  vector<Move> move_list;
+  move_list.clear();
   if (captures_only) {
     // Remove all squares not occupied by the enemy player when generating
     // captures only.
@@ -185,12 +368,118 @@ auto Engine::GenerateMoves(bool captures_only) const -> vector<Move> {
                      moving_piece, start_sq);
     RemoveFirstPiece(moving_pieces);
   }
+}
 
-  return move_list;
+auto Engine::GenerateEvasions(vector<Move>& move_list, Bitboard checkers,
+                              bool captures_only) const -> void {
+  S8 moving_player = board_->GetPlayerToMove();
+  S8 enemy_player = GetOtherPlayer(moving_player);
+  Bitboard moving_pieces = board_->GetPiecesByType(kNA, moving_player);
+  Bitboard enemy_pieces = board_->GetPiecesByType(kNA, enemy_player);
+  Bitboard king_board = board_->GetPiecesByType(kKing, moving_player);
+  S8 king_sq = GetSqOfFirstPiece(king_board);
+  move_list.clear();
+
+  // Move the king onto squares that aren't attacked. The king is removed from
+  // the occupancy so that squares behind it on the line of a checking slider
+  // are seen as attacked.
+  Bitboard king_targets = board_->GetAttackMap(moving_player, king_sq, kKing) &
+                          (captures_only ? enemy_pieces : ~moving_pieces);
+  Bitboard occupancy = (moving_pieces | enemy_pieces) ^ king_board;
+  Bitboard safe_king_targets = 0;
+  while (king_targets) {
+    S8 target_sq = GetSqOfFirstPiece(king_targets);
+    if (!(board_->GetAttackersToSq(target_sq, occupancy) & enemy_pieces)) {
+      safe_king_targets |= 1ULL << target_sq;
+    }
+    RemoveFirstPiece(king_targets);
+  }
+
+  // Only the king can escape a double check. Otherwise the other pieces may
+  // capture the checker, or block it if it's a slider.
+  if (MultipleSetSq(checkers)) {
+    AddMovesForPiece(move_list, safe_king_targets, enemy_player,
+                     moving_player, kKing, king_sq);
+    return;
+  }
+  Bitboard target_mask = checkers;
+  if (!captures_only) {
+    target_mask |= kBetweenMasks[king_sq][GetSqOfFirstPiece(checkers)];
+  }
+
+  // Add moves in the same order as GenerateMoves(), so that evasions are
+  // searched in the same order as before among moves of equal priority.
+  AddEpMoves(move_list, enemy_player, moving_player);
+  while (moving_pieces) {
+    S8 start_sq = GetSqOfFirstPiece(moving_pieces);
+    S8 moving_piece = board_->GetPieceOnSq(start_sq);
+    Bitboard attack_map =
+        (moving_piece == kKing)
+            ? safe_king_targets
+            : board_->GetAttackMap(moving_player, start_sq, moving_piece) &
+                  target_mask;
+    AddMovesForPiece(move_list, attack_map, enemy_player, moving_player,
+                     moving_piece, start_sq);
+    RemoveFirstPiece(moving_pieces);
+  }
+}
+
+auto Engine::NewPosition() -> void {
+  ClearHistory();
+  for (SearchStackFrame& frame : search_stack_) {
+    fill(begin(frame.killer_moves), end(frame.killer_moves), Move());
+  }
+  fill(&history_scores_[0][0][0],
+       &history_scores_[0][0][0] + sizeof(history_scores_) / sizeof(int), 0);
+  fill(&counter_moves_[0][0][0],
+       &counter_moves_[0][0][0] + sizeof(counter_moves_) / sizeof(Move),
+       Move());
 }
 
 // Implement private member functions.
 
+auto Engine::GetTablebaseMove(Move& best_move) -> bool {
+  if (!ProbeTablebase(search_eval_)) {
+    return false;
+  }
+  TablebaseResult root_result;
+  search_options_.tablebases->Probe(*board_, root_result);
+
+  int best_dtc = -1;
+  vector<Move> move_list = GenerateMoves();
+  for (const Move& move : move_list) {
+    try {
+      board_->MakeMove(move);
+    } catch (BadMove& e) {
+      continue;
+    }
+    TablebaseResult child_result;
+    bool child_probed =
+        search_options_.tablebases->Probe(*board_, child_result);
+    board_->UnmakeMove(move);
+    if (!child_probed) {
+      return false;
+    }
+    if (-child_result.wdl != root_result.wdl) {
+      continue;
+    }
+
+    // Captures and promotions convert to a smaller table, which resets the
+    // distance to conversion.
+    bool is_conversion =
+        move.captured_piece != kNA || move.promoted_to_piece != kNA;
+    int dtc = is_conversion ? 1 : child_result.dtc + 1;
+    bool is_better_move =
+        (root_result.wdl == kTablebaseWin && dtc < best_dtc) ||
+        (root_result.wdl == kTablebaseLoss && dtc > best_dtc);
+    if (best_dtc < 0 || is_better_move) {
+      best_move = move;
+      best_dtc = dtc;
+    }
+  }
+  return best_dtc >= 0;
+}
+
 auto Engine::MtdfSearch(int f, int d, int ply, Move& best_move) -> int {
   // Perform the MTD(f) algorithm, where f is the first guess for best value,
   // d is the depth to loop for, and g is the current guess.
@@ -204,6 +493,7 @@ auto Engine::MtdfSearch(int f, int d, int ply, Move& best_move) -> int {
     } else {
       beta = g;
     }
+    RecordStat(stats_.root_passes);
     g = NegamaxSearch(best_move, beta - 1, beta, d, ply, true, d != 1);
     if (g < beta) {
       upper_bound = g;
@@ -214,21 +504,80 @@ auto Engine::MtdfSearch(int f, int d, int ply, Move& best_move) -> int {
   return g;
 }
 
+auto Engine::AspirationSearch(int prev_eval, int depth, int ply,
+                              Move& best_move) -> int {
+  // Search shallow depths and mate scores with a full window, since the
+  // previous evaluation is too unstable to center a window on.
+  constexpr int kMinAspirationDepth = 4;
+  constexpr int kMaxAspirationEval = kPieceVals[kKing];
+  if (depth < kMinAspirationDepth || abs(prev_eval) >= kMaxAspirationEval) {
+    RecordStat(stats_.root_passes);
+    return NegamaxSearch(best_move, kWorstEval, kBestEval, depth, ply, true,
+                         depth != 1);
+  }
+
+  // Widen the window on the side that failed by doubling its size each time,
+  // falling back to a full window once it grows larger than a queen.
+  constexpr int kInitialWindow = 25;
+  constexpr int kMaxWindow = kPieceVals[kQueen];
+  int alpha_window = kInitialWindow;
+  int beta_window = kInitialWindow;
+  int alpha;
+  int beta;
+  int eval;
+  for (;;) {
+    alpha = (alpha_window > kMaxWindow) ? kWorstEval : prev_eval - alpha_window;
+    beta = (beta_window > kMaxWindow) ? kBestEval : prev_eval + beta_window;
+    RecordStat(stats_.root_passes);
+    eval = NegamaxSearch(best_move, alpha, beta, depth, ply, true, true);
+    if (eval <= alpha && alpha != kWorstEval) {
+      // Re-search after failing low.
+      alpha_window *= 2;
+    } else if (eval >= beta && beta != kBestEval) {
+      // Re-search after failing high.
+      beta_window *= 2;
+    } else {
+      return eval;
+    }
+  }
+}
+
 auto Engine::NegamaxSearch(Move& pv_move, int alpha, int beta, int depth,
                            int ply, bool null_move_allowed, bool check_time)
     -> int {
+  ++node_count_;
+  RecordStat(stats_.nodes);
   if (check_time) {
-    CheckSearchTime();
+    CheckSearchLimits();
+  }
+
+  // Follow the previous iteration's principal variation while every move made
+  // so far is on it.
+  SearchStackFrame& frame = search_stack_[ply];
+  if (ply == 0) {
+    frame.on_pv = true;
+  } else {
+    const SearchStackFrame& parent_frame = search_stack_[ply - 1];
+    frame.on_pv = parent_frame.on_pv && parent_frame.current_move ==
+                                            GetPvMove(ply - 1);
   }
+  pv_lengths_[ply] = 0;
 
   int orig_alpha = alpha;
   int transposition_table_stored_eval;
   S8 node_type;
   // Check the transposition table for previously stored evaluations.
+  RecordStat(stats_.tt_probes);
   if (transposition_table_.Access(board_, depth,
                                   transposition_table_stored_eval, node_type)) {
+    RecordStat(stats_.tt_hits[node_type]);
     if (node_type == kPvNode) {
+      RecordStat(stats_.tt_cutoffs[kPvNode]);
       pv_move = transposition_table_.GetHashMove(board_);
+      if (pv_move.moving_piece != kNA || pv_move.castling_type != kNA) {
+        pv_table_[ply][0] = pv_move;
+        pv_lengths_[ply] = 1;
+      }
       return transposition_table_stored_eval;
     }
     if (node_type == kCutNode) {
@@ -238,6 +587,7 @@ auto Engine::NegamaxSearch(Move& pv_move, int alpha, int beta, int depth,
     }
 
     if (alpha >= beta) {
+      RecordStat(stats_.tt_cutoffs[node_type]);
       return transposition_table_stored_eval;
     }
   }
@@ -249,25 +599,71 @@ auto Engine::NegamaxSearch(Move& pv_move, int alpha, int beta, int depth,
   if (game_status == kDraw || RepDetected()) {
     return kNeutralEval;
   }
+  frame.in_check = game_status == kPlayerInCheck;
+  int tablebase_eval;
+  if (ply > 0 && ProbeTablebase(tablebase_eval)) {
+    RecordStat(stats_.tablebase_hits);
+    return tablebase_eval;
+  }
   if (depth <= 0) {
     // Initiate the Quiescence search when maximum depth is reached.
-    return QuiescenceSearch(alpha, beta);
+    return QuiescenceSearch(alpha, beta, ply);
   }
 
-  bool at_pv_node = transposition_table_.PosIsPvNode(board_);
+  // Treat nodes searched with an open window during a Principal Variation
+  // Search as PV nodes, along with those stored as PV nodes in the table.
+  bool at_pv_node =
+      beta - alpha > 1 || transposition_table_.PosIsPvNode(board_);
+
+  // Prune frontier nodes whose static evaluation is far outside the window.
+  // The static evaluation can't be trusted in check, and the root must always
+  // search for a move.
+  constexpr int kMaxFrontierDepth = 3;
+  bool frontier_node = ply > 0 && depth <= kMaxFrontierDepth && !at_pv_node &&
+                       !frame.in_check;
+  bool futile_node = false;
+  bool frontier_pruning = search_options_.reverse_futility_pruning ||
+                          search_options_.futility_pruning ||
+                          search_options_.razoring;
+  if (frontier_pruning && frontier_node) {
+    frame.static_eval = board_->Evaluate();
+    if (search_options_.reverse_futility_pruning && ZugzwangUnlikely() &&
+        frame.static_eval - search_options_.reverse_futility_margin * depth >=
+            beta) {
+      RecordStat(stats_.reverse_futility_prunes);
+      return beta;
+    }
+    if (search_options_.razoring &&
+        frame.static_eval + search_options_.razoring_margin * depth <= alpha) {
+      // Return the quiescence search evaluation if it confirms that the node
+      // fails low.
+      RecordStat(stats_.razoring_attempts);
+      int razoring_eval = QuiescenceSearch(alpha, alpha + 1, ply);
+      if (razoring_eval <= alpha) {
+        RecordStat(stats_.razoring_cutoffs);
+        return razoring_eval;
+      }
+    }
+    futile_node =
+        search_options_.futility_pruning &&
+        frame.static_eval + search_options_.futility_margin * depth <= alpha;
+  }
 
   // Compute the depth reduction value (R) for Null-Move pruning.
   constexpr int kNullMoveDepthMin = 4;
   constexpr int kDepthReductionIncreaseBoundary = 6;
   int R = (depth > kDepthReductionIncreaseBoundary) ? 3 : 2;
   if (depth >= kNullMoveDepthMin && null_move_allowed && !at_pv_node &&
-      ZugzwangUnlikely() && !board_->KingInCheck()) {
+      ZugzwangUnlikely() && !frame.in_check) {
+    RecordStat(stats_.null_move_attempts);
+    frame.current_move = Move();
     board_->MakeNullMove();
     int null_move_eval = -NegamaxSearch(-beta, -alpha, depth - R - 1, ply + 1,
                                         false, check_time);
     board_->UnmakeNullMove();
     if (null_move_eval >= beta) {
       // Perform a null-move prune.
+      RecordStat(stats_.null_move_cutoffs);
       return beta;
     }
   }
@@ -276,62 +672,126 @@ auto Engine::NegamaxSearch(Move& pv_move, int alpha, int beta, int depth,
   // Reduction, the number of early moves.
   constexpr S8 kNumEarlyMoves = 3;
   constexpr S8 kMinReductionDepth = 3;
+  // Store the number of legal moves searched at frontier nodes before later
+  // quiet moves are pruned, which grows with the square of the depth.
+  constexpr int kNumLateMovePruningMoves = 3;
+  int num_unpruned_moves =
+      search_options_.late_move_pruning && frontier_node
+          ? kNumLateMovePruningMoves + depth * depth
+          : numeric_limits<int>::max();
   // Use the Negamax algorithm to traverse the search tree.
-  vector<Move> move_list = GenerateMoves();
-  move_list = OrderMoves(move_list, ply);
-  queue<U64> saved_pos_history = pos_history_;
+  vector<Move>& move_list = frame.move_list;
+  if (frame.in_check) {
+    GenerateEvasions(move_list, board_->GetCheckers());
+  } else {
+    GenerateMoves(move_list);
+  }
+  OrderMoves(move_list, frame.move_scores, ply);
   Move best_move;
   Move move;
   int best_eval = kWorstEval;
   int search_eval;
   int depth_reduction;
+  int num_legal_moves = 0;
+  vector<Move> failed_quiet_moves;
   // Iterate through all child nodes of the current position.
   size_t num_moves = move_list.size();
   for (size_t move_idx = 0; move_idx < num_moves; ++move_idx) {
     // cout << "MOVE: " << move_idx << endl;
     move = move_list[move_idx];
+    PrefetchMove(move);
     try {
       board_->MakeMove(move);
     } catch (BadMove& e) {
       // Ignore moves that put the player's king in check.
       continue;
     }
+    bool quiet_move = move.captured_piece == kNA &&
+                      move.promoted_to_piece == kNA && !board_->KingInCheck();
+    // Skip quiet moves that don't give check at futile nodes once a move has
+    // been searched, and at frontier nodes once enough moves have been
+    // searched.
+    if (quiet_move && num_legal_moves > 0 && futile_node) {
+      board_->UnmakeMove(move);
+      RecordStat(stats_.futility_prunes);
+      continue;
+    }
+    if (quiet_move && num_legal_moves >= num_unpruned_moves) {
+      board_->UnmakeMove(move);
+      RecordStat(stats_.late_move_prunes);
+      continue;
+    }
 
-    AddPosToHistory();
-    if (move_idx >= kNumEarlyMoves && !at_pv_node &&
-        move.captured_piece == kNA && move.promoted_to_piece == kNA &&
-        !board_->KingInCheck() && depth >= kMinReductionDepth) {
-      // Perform Late Move Reduction.
-      depth_reduction =
-          static_cast<int>(sqrt(static_cast<double>(depth - 1)) +
-                           sqrt(static_cast<double>(move_idx - 1)));
-      search_eval = -NegamaxSearch(-beta, -alpha, depth - depth_reduction - 1,
-                                   ply + 1, true, check_time);
+    pos_history_.push_back(board_->GetBoardHash());
+    frame.current_move = move;
+    ++num_legal_moves;
+    RecordStat(stats_.moves_searched);
+    if (num_legal_moves == 1) {
+      // Search the first legal move with the full window.
+      RecordStat(stats_.expanded_nodes);
+      search_eval =
+          -NegamaxSearch(-beta, -alpha, depth - 1, ply + 1, true, check_time);
+    } else {
+      // Search later moves with a null window to prove they're no better than
+      // the current best move. Note that every search done by MTD(f) already
+      // uses a null window, so this only changes Principal Variation Search.
+      search_eval = alpha + 1;
+      // Index reductions by the legal moves searched before this one, as late
+      // move pruning counts them, rather than by the position in the move
+      // list, which includes illegal and pruned moves.
+      int legal_move_idx = num_legal_moves - 1;
+      if (legal_move_idx >= kNumEarlyMoves && !at_pv_node && quiet_move &&
+          depth >= kMinReductionDepth) {
+        // Perform Late Move Reduction.
+        RecordStat(stats_.lmr_reductions);
+        // Leave at least one ply to search, since a reduced search dropping
+        // straight into the quiescence search costs more than it saves.
+        depth_reduction =
+            min(static_cast<int>(kLmrReductions[depth][legal_move_idx]),
+                depth - 2);
+        search_eval =
+            -NegamaxSearch(-alpha - 1, -alpha, depth - depth_reduction - 1,
+                           ply + 1, true, check_time);
+        if (search_eval > alpha) {
+          RecordStat(stats_.lmr_researches);
+        }
+      }
       if (search_eval > alpha) {
-        // Perform a re-search at full depth.
+        // Perform a null window search at full depth.
+        search_eval = -NegamaxSearch(-alpha - 1, -alpha, depth - 1, ply + 1,
+                                     true, check_time);
+      }
+      if (search_eval > alpha && search_eval < beta) {
+        // Perform a re-search with the full window if the move may improve the
+        // principal variation.
         search_eval =
             -NegamaxSearch(-beta, -alpha, depth - 1, ply + 1, true, check_time);
       }
-    } else {
-      // Search at full depth.
-      search_eval =
-          -NegamaxSearch(-beta, -alpha, depth - 1, ply + 1, true, check_time);
     }
     board_->UnmakeMove(move);
-    pos_history_.swap(saved_pos_history);
+    pos_history_.pop_back();
     if (search_eval > best_eval) {
       best_move = move;
       pv_move = best_move;
       best_eval = search_eval;
+      UpdatePvTable(move, ply);
     }
     alpha = max(alpha, search_eval);
     if (alpha >= beta) {
+      RecordStat(stats_.beta_cutoffs);
+      if (num_legal_moves == 1) {
+        RecordStat(stats_.first_move_cutoffs);
+      }
       if (move.captured_piece == kNA) {
         RecordKillerMove(move, ply);
+        RecordQuietCutoff(move, failed_quiet_moves, depth, ply);
       }
       // Prune a subtree when a beta cutoff is detected.
       break;
     }
+    if (move.captured_piece == kNA) {
+      failed_quiet_moves.push_back(move);
+    }
   }
 
   // Store a searched node in the transposition table.
@@ -346,17 +806,51 @@ auto Engine::NegamaxSearch(Move& pv_move, int alpha, int beta, int depth,
   return best_eval;
 }
 
-auto Engine::QuiescenceSearch(int alpha, int beta) -> int {
+auto Engine::QuiescenceSearch(int alpha, int beta, int ply) -> int {
+  ++node_count_;
+  RecordStat(stats_.nodes);
+  RecordStat(stats_.qsearch_nodes);
+  if (RepDetected()) {
+    return kNeutralEval;
+  }
+
+  // Check the transposition table for an evaluation stored by either search
+  // before finding the game status, which generates and tries every move.
+  // Stored evaluations already account for checkmate and stalemate.
+  int orig_alpha = alpha;
+  int transposition_table_stored_eval;
+  S8 node_type;
+  RecordStat(stats_.qsearch_tt_probes);
+  if (transposition_table_.Access(board_, kQuiescenceDepth,
+                                  transposition_table_stored_eval,
+                                  node_type)) {
+    if (node_type == kPvNode) {
+      RecordStat(stats_.qsearch_tt_cutoffs);
+      return transposition_table_stored_eval;
+    }
+    if (node_type == kCutNode && transposition_table_stored_eval >= beta) {
+      RecordStat(stats_.qsearch_tt_cutoffs);
+      return beta;
+    }
+    if (node_type == kAllNode && transposition_table_stored_eval <= alpha) {
+      RecordStat(stats_.qsearch_tt_cutoffs);
+      return alpha;
+    }
+  }
+
   S8 game_status = GetGameStatus();
   if (game_status == kPlayerCheckmated) {
     return kWorstEval;
-  } else if (game_status == kDraw || RepDetected()) {
+  } else if (game_status == kDraw) {
     return kNeutralEval;
   }
 
   // Establish a lower bound for the node evaluation (stand_pat_eval),
   // and perform a beta cutoff if this value exceeds beta.
+  SearchStackFrame& frame = search_stack_[ply];
+  frame.in_check = game_status == kPlayerInCheck;
   int stand_pat_eval = board_->Evaluate();
+  frame.static_eval = stand_pat_eval;
   if (stand_pat_eval >= beta) {
     return beta;
   }
@@ -373,113 +867,180 @@ auto Engine::QuiescenceSearch(int alpha, int beta) -> int {
   }
 
   // Generate captures only.
-  vector<Move> move_list = GenerateMoves(true);
-  move_list = OrderMoves(move_list);
-  queue<U64> saved_pos_rep_table = pos_history_;
+  vector<Move>& move_list = frame.move_list;
+  if (frame.in_check) {
+    GenerateEvasions(move_list, board_->GetCheckers(), true);
+  } else {
+    GenerateMoves(move_list, true);
+  }
+  OrderMoves(move_list, frame.move_scores);
+  Move best_move;
   for (const Move& move : move_list) {
+    // Prune captures that lose material, which are unlikely to raise alpha.
+    if (IsLosingCapture(move)) {
+      RecordStat(stats_.see_prunes);
+      continue;
+    }
+    PrefetchMove(move);
     try {
       board_->MakeMove(move);
     } catch (BadMove& e) {
       continue;
     }
-    AddPosToHistory();
-    // Calculate the evalulation directly rather than using the transposition
-    // table to avoid cache misses.
-    stand_pat_eval = -QuiescenceSearch(-beta, -alpha);
+    pos_history_.push_back(board_->GetBoardHash());
+    frame.current_move = move;
+    stand_pat_eval = -QuiescenceSearch(-beta, -alpha, ply + 1);
     board_->UnmakeMove(move);
-    pos_history_ = saved_pos_rep_table;
+    pos_history_.pop_back();
 
     if (stand_pat_eval >= beta) {
+      transposition_table_.Update(board_, kQuiescenceDepth, beta, kCutNode,
+                                  move);
       return beta;
     }
-    alpha = max(stand_pat_eval, alpha);
+    if (stand_pat_eval > alpha) {
+      best_move = move;
+      alpha = stand_pat_eval;
+    }
   }
 
+  // Store the result of a node whose captures were searched, since the
+  // results of those cut off by standing pat are cheap to recompute.
+  if (alpha <= orig_alpha) {
+    transposition_table_.Update(board_, kQuiescenceDepth, alpha, kAllNode);
+  } else {
+    transposition_table_.Update(board_, kQuiescenceDepth, alpha, kPvNode,
+                                best_move);
+  }
   return alpha;
 }
 
-auto Engine::OrderMoves(vector<Move> move_list, int ply) const -> vector<Move> {
+auto Engine::OrderMoves(vector<Move>& move_list, vector<int>& move_scores,
+                        int ply) const -> void {
+  Move pv_move = GetPvMove(ply);
   Move hash_move = transposition_table_.GetHashMove(board_);
+  Move counter_move = GetCounterMove(ply);
+  S8 player_to_move = board_->GetPlayerToMove();
 
-  vector<pair<Move, int>> ordered_capture_pairs;
-  vector<Move> silent_moves;
-  vector<Move> killer_moves;
-  vector<Move> ordered_moves;
-  ordered_moves.reserve(move_list.size());
-  for (const Move& move : move_list) {
-    // Prioritize a move if it's the previously calculated best move of a
-    // node.
-    if (move == hash_move) {
-      ordered_moves.push_back(move);
+  // Place the principal variation and hash moves first, followed by captures
+  // that don't lose material, killer moves, the counter move, all other silent
+  // moves, and finally losing captures.
+  move_scores.resize(move_list.size());
+  for (size_t move_idx = 0; move_idx < move_list.size(); ++move_idx) {
+    const Move& move = move_list[move_idx];
+    int& score = move_scores[move_idx];
+    if (move == pv_move) {
+      score = kPvMoveScore;
+    } else if (move == hash_move) {
+      score = kHashMoveScore;
     } else if (move.captured_piece != kNA) {
       // Use the MVV-LVA heuristic to order captures.
-      ordered_capture_pairs.emplace_back(
-          move, kVictimSortVals[move.captured_piece] +
-                    kAggressorSortVals[move.moving_piece]);
+      int mvv_lva_val = kVictimSortVals[move.captured_piece] +
+                        kAggressorSortVals[move.moving_piece];
+      score = IsLosingCapture(move) ? kLosingCaptureScore + mvv_lva_val
+                                    : kCaptureScore + mvv_lva_val;
     } else if (IsKillerMove(move, ply)) {
       // Use the Killer Move heuristic to order quiet moves.
-      killer_moves.push_back(move);
+      score = kKillerMoveScore;
+    } else if (move == counter_move) {
+      score = kCounterMoveScore;
+    } else if (move.castling_type != kNA) {
+      // Castling moves aren't tracked by the history heuristic.
+      score = kSilentMoveScore;
     } else {
       // Use the history heuristic to order silent, non-killer moves.
-      silent_moves.push_back(move);
+      score = kSilentMoveScore +
+              history_scores_[player_to_move][move.start_sq][move.target_sq];
+    }
+  }
+  SortMovesByScore(move_list, move_scores);
+}
+
+auto Engine::OrderMoves(vector<Move>& move_list, vector<int>& move_scores) const
+    -> void {
+  Move hash_move = transposition_table_.GetHashMove(board_);
+
+  // Place the hash move first, followed by captures, ordered by the MVV-LVA
+  // heuristic, and all other moves.
+  move_scores.resize(move_list.size());
+  for (size_t move_idx = 0; move_idx < move_list.size(); ++move_idx) {
+    const Move& move = move_list[move_idx];
+    if (move == hash_move) {
+      move_scores[move_idx] = kHashMoveScore;
+    } else if (move.captured_piece == kNA) {
+      move_scores[move_idx] = kSilentMoveScore;
+    } else {
+      move_scores[move_idx] = kCaptureScore +
+                              kVictimSortVals[move.captured_piece] +
+                              kAggressorSortVals[move.moving_piece];
     }
   }
+  SortMovesByScore(move_list, move_scores);
+}
+
+auto Engine::RecordQuietCutoff(const Move& move,
+                               const vector<Move>& failed_quiet_moves,
+                               int depth, int ply) -> void {
+  // Castling moves aren't tracked by the history heuristic.
+  if (move.castling_type != kNA) {
+    return;
+  }
 
-  // Sort captures by descending value of their MVV-LVA heuristic.
-  sort(ordered_capture_pairs.begin(), ordered_capture_pairs.end(),
-       [](const pair<Move, int>& lhs, const pair<Move, int>& rhs) {
-         return lhs.second > rhs.second;
-       });
-  vector<Move> captures;
-  captures.reserve(ordered_capture_pairs.size());
-  for (const pair<Move, int>& capture_eval_pair : ordered_capture_pairs) {
-    captures.push_back(capture_eval_pair.first);
+  S8 player_to_move = board_->GetPlayerToMove();
+  int bonus = min(depth * depth, kMaxHistoryBonus);
+  UpdateHistoryScore(move, player_to_move, bonus);
+  for (const Move& failed_move : failed_quiet_moves) {
+    if (failed_move.castling_type == kNA) {
+      UpdateHistoryScore(failed_move, player_to_move, -bonus);
+    }
   }
 
-  // Place all hash moves first, followed by captures, then killer moves, and
-  // finally all silent, non-killer moves.
-  ordered_moves.insert(ordered_moves.end(), captures.begin(), captures.end());
-  ordered_moves.insert(ordered_moves.end(), killer_moves.begin(),
-                       killer_moves.end());
-  ordered_moves.insert(ordered_moves.end(), silent_moves.begin(),
-                       silent_moves.end());
-  return ordered_moves;
+  // Store the move as the refutation of the move made at the previous ply.
+  if (ply > 0) {
+    const Move& prev_move = search_stack_[ply - 1].current_move;
+    if (prev_move.moving_piece != kNA && prev_move.castling_type == kNA) {
+      counter_moves_[GetOtherPlayer(player_to_move)][prev_move.moving_piece]
+                    [prev_move.target_sq] = move;
+    }
+  }
 }
 
-auto Engine::OrderMoves(vector<Move> move_list) const -> vector<Move> {
-  Move best_move;
+auto Engine::OutputStats(int depth) -> void {
+  if (search_options_.stats_format == kNoStats) {
+    return;
+  }
 
-  vector<pair<Move, int>> ordered_capture_pairs;
-  vector<Move> late_moves;
-  for (const Move& move : move_list) {
-    if (move.captured_piece == kNA) {
-      late_moves.push_back(move);
-    } else {
-      // Use the MVV-LVA heuristic to order captures.
-      ordered_capture_pairs.emplace_back(
-          move, kVictimSortVals[move.captured_piece] +
-                    kAggressorSortVals[move.moving_piece]);
-    }
-  }
-  // Sort captures by descending value of their MVV-LVA heuristic.
-  sort(ordered_capture_pairs.begin(), ordered_capture_pairs.end(),
-       [](const pair<Move, int>& lhs, const pair<Move, int>& rhs) {
-         return lhs.second > rhs.second;
-       });
-
-  vector<Move> captures;
-  captures.reserve(ordered_capture_pairs.size());
-  for (const pair<Move, int>& capture_eval_pair : ordered_capture_pairs) {
-    captures.push_back(capture_eval_pair.first);
-  }
-
-  // Place captures first, followed by all other moves.
-  vector<Move> ordered_moves;
-  ordered_moves.reserve(move_list.size());
-  ordered_moves.insert(ordered_moves.end(), captures.begin(), captures.end());
-  ordered_moves.insert(ordered_moves.end(), late_moves.begin(),
-                       late_moves.end());
-  return ordered_moves;
+  const PawnTable& pawn_table = board_->GetPawnTable();
+  stats_.pawn_table_probes = pawn_table.GetNumProbes();
+  stats_.pawn_table_hits = pawn_table.GetNumHits();
+  const EvalCache& eval_cache = board_->GetEvalCache();
+  stats_.eval_cache_probes = eval_cache.GetNumProbes();
+  stats_.eval_cache_hits = eval_cache.GetNumHits();
+  if (search_options_.stats_format == kJsonStats) {
+    cout << stats_.ToJson(depth, prev_iteration_nodes_) << endl;
+  } else {
+    cout << stats_.ToText(depth, prev_iteration_nodes_) << endl;
+  }
+
+  prev_iteration_nodes_ = stats_.nodes;
+  stats_.Clear();
+  board_->ResetPawnTableStats();
+  board_->ResetEvalCacheStats();
+}
+
+auto Engine::UpdatePrincipalVariation(int depth, int eval) -> void {
+  principal_variation_.assign(pv_table_[0], pv_table_[0] + pv_lengths_[0]);
+  if (!search_options_.verbose) {
+    return;
+  }
+
+  cout << "DEPTH " << depth << " EVAL " << eval << " PV:";
+  S8 moving_player = board_->GetPlayerToMove();
+  for (const Move& move : principal_variation_) {
+    cout << " " << GetUciMoveStr(move, moving_player);
+    moving_player = GetOtherPlayer(moving_player);
+  }
+  cout << endl;
 }
 
 auto Engine::AddCastlingMoves(vector<Move>& move_list) const -> void {
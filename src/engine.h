@@ -12,14 +12,17 @@
 
 #include <algorithm>
 #include <chrono>
-#include <queue>
+#include <cstdlib>
 #include <stdexcept>
 #include <utility>
 #include <vector>
 
 #include "board.h"
+#include "eval_params.h"
 #include "move.h"
 #include "out_of_time.h"
+#include "search_stats.h"
+#include "tablebase.h"
 #include "transposition_table.h"
 
 namespace omegazero {
@@ -30,7 +33,6 @@ using std::end;
 using std::invalid_argument;
 using std::numeric_limits;
 using std::pair;
-using std::queue;
 using std::unordered_map;
 using std::vector;
 using std::chrono::duration;
@@ -43,9 +45,17 @@ enum GameStatus : S8 {
   kDraw,
   kPlayerCheckmated,
 };
+enum SearchAlgorithm : S8 {
+  kMtdf,
+  kAspirationPvs,
+};
 
 constexpr int kRanOutOfTime = 2;
-constexpr int kSearchLimit = 50;
+constexpr int kSearchLimit = 128;
+// Bound the length of a quiescence search line, which only makes captures and
+// so can't make more than 30 moves.
+constexpr int kMaxQuiescencePlys = 32;
+constexpr int kMaxSearchPly = kSearchLimit + kMaxQuiescencePlys;
 
 // Store values used for transposition table move ordering.
 constexpr int kBestEval = INT32_MAX;
@@ -56,9 +66,99 @@ constexpr int kWorstEval = -INT32_MAX;
 
 constexpr S8 kSixPlys = 6;
 
+// Score tablebase wins below checkmate but above any material evaluation, and
+// prefer wins with a shorter distance to conversion.
+constexpr int kTablebaseWinEval = 2 * kPieceVals[kKing];
+
+// Bound the history heuristic scores, and the amount a single beta cutoff can
+// change them by.
+constexpr int kMaxHistoryScore = 16384;
+constexpr int kMaxHistoryBonus = 1600;
+
+// Store the default margins of the forward pruning techniques applied near the
+// leaves, given per ply of remaining depth.
+constexpr int kDefaultReverseFutilityMargin = 100;
+constexpr int kDefaultFutilityMargin = 150;
+constexpr int kDefaultRazoringMargin = 250;
+
+// Store options which control how the engine searches for moves.
+struct SearchOptions {
+  // Select the root search driver used inside iterative deepening.
+  S8 search_algorithm = kMtdf;
+  // Search to exactly this depth, ignoring the search time, when positive.
+  int depth_limit = 0;
+  // Stop searching once this many nodes have been visited when positive.
+  U64 node_limit = 0;
+  // Size the transposition table to this many megabytes.
+  int hash_size_mb = kDefaultHashSizeMb;
+  // Toggle the forward pruning techniques applied at non-PV nodes within three
+  // plies of the leaves, so that their effect can be measured. Reverse
+  // futility pruning returns beta when the static evaluation beats it by the
+  // margin, futility pruning skips quiet moves when the static evaluation
+  // plus the margin can't reach alpha, and razoring drops into the quiescence
+  // search when the static evaluation plus the margin is below alpha.
+  bool reverse_futility_pruning = true;
+  bool futility_pruning = true;
+  bool razoring = true;
+  int reverse_futility_margin = kDefaultReverseFutilityMargin;
+  int futility_margin = kDefaultFutilityMargin;
+  int razoring_margin = kDefaultRazoringMargin;
+  // Toggle late move pruning, which skips quiet moves that don't give check at
+  // the same frontier nodes once a number of moves growing with the depth has
+  // been searched.
+  bool late_move_pruning = true;
+  // Print information about each search to standard output.
+  bool verbose = true;
+  // Output search statistics after each iteration of iterative deepening in
+  // the given format. Requires a build with search statistics.
+  S8 stats_format = kNoStats;
+  // Read the exact evaluation of positions covered by these endgame
+  // tablebases instead of searching them, when not null.
+  const Tablebases* tablebases = nullptr;
+  // Evaluate positions with these weights instead of the built-in defaults,
+  // when not null.
+  const EvalParams* eval_params = nullptr;
+  // Evaluate positions with this NNUE network instead of the hand-crafted
+  // evaluation, when not null.
+  const NnueNetwork* nnue_network = nullptr;
+};
+
+// Store the number of leaves of a Perft tree, broken down by the type of the
+// move leading to each leaf as in the reference Perft tables. Captures
+// include en passent captures.
+struct PerftCounts {
+  U64 nodes = 0;
+  U64 captures = 0;
+  U64 eps = 0;
+  U64 castles = 0;
+  U64 promotions = 0;
+  U64 checks = 0;
+  U64 checkmates = 0;
+};
+
+// Store the search state of one ply of the line currently being searched.
+struct SearchStackFrame {
+  // Store the two most recent quiet moves which caused beta cutoffs at this
+  // ply, most recent first.
+  Move killer_moves[2];
+  // Store the move made at this ply, which is a null move when a null move
+  // was made.
+  Move current_move;
+  int static_eval = 0;
+  bool in_check = false;
+  // Indicate if every move made before this ply follows the principal
+  // variation of the previous iteration.
+  bool on_pv = false;
+  // Hold the moves of the node at this ply and their move ordering scores,
+  // reusing their storage from node to node.
+  vector<Move> move_list;
+  vector<int> move_scores;
+};
+
 class Engine {
  public:
-  Engine(Board* board, S8 player_side, float search_time);
+  Engine(Board* board, S8 player_side, float search_time,
+         const SearchOptions& search_options = SearchOptions());
 
   // Searches possible games in a search tree to find the best legal move. Act
   // as the root function to call the Negamax search algorithm in an iterative
@@ -69,22 +169,71 @@ class Engine {
   // check for move repititions.
   auto GetGameStatus() -> S8;
   auto GetUserSide() const -> S8;
+  // Return the number of nodes visited during the last search.
+  auto GetNodeCount() const -> U64;
+  // Return the evaluation of the best move found by the last search, relative
+  // to the player to move, and the deepest search iteration it completed.
+  auto GetSearchEval() const -> int;
+  auto GetSearchDepth() const -> int;
+  // Return the principal variation of the deepest search iteration completed
+  // by the last search, starting with the best move.
+  auto GetPrincipalVariation() const -> const vector<Move>&;
 
   // Counts the number of leaves of the tree of specified depth whose root
-  // node is is the current board state.
+  // node is is the current board state. Moves on the last ply are counted
+  // without being made.
   auto Perft(int depth) -> U64;
+  // Count the leaves of the same tree by the type of move leading to them,
+  // adding them to counts. Every leaf is made to find checks and checkmates.
+  auto Perft(int depth, PerftCounts& counts) -> void;
 
   // Finds all pseudo-legal moves able to be played at the current board state.
   auto GenerateMoves(bool captures_only = false) const -> vector<Move>;
+  // Store the same moves in move_list, replacing its contents.
+  auto GenerateMoves(vector<Move>& move_list, bool captures_only = false) const
+      -> void;
+  // Store the pseudo-legal moves which may escape check in move_list when the
+  // player to move is checked by the given checkers: king moves to squares
+  // that aren't attacked and, unless in double check, captures of the checker
+  // and moves onto the squares between it and the king. Moves of pinned
+  // pieces are still left to be rejected by Board::MakeMove().
+  auto GenerateEvasions(vector<Move>& move_list, Bitboard checkers,
+                        bool captures_only = false) const -> void;
+
+  // Attempts to predict which moves are likely to be better, and order those
+  // towards the front of the move_list to increase the number of moves that
+  // can be pruned during alpha-beta pruning. Moves are reordered in place,
+  // using move_scores as scratch space for their scores. The second overload
+  // orders the captures of the quiescence search.
+  auto OrderMoves(vector<Move>& move_list, vector<int>& move_scores,
+                  int ply) const -> void;
+  auto OrderMoves(vector<Move>& move_list, vector<int>& move_scores) const
+      -> void;
 
   // Adds a board repitition to keep enforce move repitition rules and return
   // the number of times the current board state has been encountered.
   auto AddPosToHistory() -> void;
+  // Forget the position history and move ordering information gathered from
+  // previous searches before searching an unrelated position.
+  auto NewPosition() -> void;
 
  private:
   auto InEndgame() const -> bool;
+  // Return the quiet move which last refuted the move made at the previous
+  // ply, or a null move if there is none.
+  auto GetCounterMove(int ply) const -> Move;
   auto IsKillerMove(const Move& move, int ply) const -> bool;
+  // Return the move of the previous iteration's principal variation at this
+  // ply if the line searched so far follows it, or a null move otherwise.
+  auto GetPvMove(int ply) const -> Move;
+  // Return if a capture loses material according to Static Exchange
+  // Evaluation.
+  auto IsLosingCapture(const Move& move) const -> bool;
   auto RepDetected() const -> bool;
+  // Look up the current position in the endgame tablebases, storing its
+  // evaluation relative to the player to move. Return false if no table covers
+  // it.
+  auto ProbeTablebase(int& eval) const -> bool;
   // Return if Zugzwang is unlikely, indicating Null-Move Heuristic should be
   // used.
   auto ZugzwangUnlikely() const -> bool;
@@ -93,29 +242,60 @@ class Engine {
   // player by searching the tree of possible moves using the Negamax
   // algorithm.
   auto MtdfSearch(int f, int d, int ply, Move& best_move) -> int;
+  // Search the root with a Principal Variation Search centered on an
+  // aspiration window around the previous iteration's evaluation, widening the
+  // window on fail highs and fail lows.
+  auto AspirationSearch(int prev_eval, int depth, int ply, Move& best_move)
+      -> int;
+  // Pick the move which preserves the tablebase result of the root position
+  // and reaches it in the fewest plies, or delays a loss the longest. Return
+  // false if the tablebases don't cover the root and every legal move.
+  auto GetTablebaseMove(Move& best_move) -> bool;
+  // Run the root search driver selected in the search options.
+  auto RootSearch(int prev_eval, int depth, int ply, Move& best_move) -> int;
   auto NegamaxSearch(int alpha, int beta, int depth, int ply,
                      bool null_move_allowed, bool check_time) -> int;
   auto NegamaxSearch(Move& pv_move, int alpha, int beta, int depth, int ply,
                      bool null_move_allowed, bool check_time) -> int;
   // Search until a "quiescent" position is reached (no capturing moves can be
   // made) to mitigate the horizon effect.
-  auto QuiescenceSearch(int alpha, int beta) -> int;
-
-  // Attempts to predict which moves are likely to be better, and order those
-  // towards the front of the move_list to increase the number of moves that
-  // can be pruned during alpha-beta pruning.
-  auto OrderMoves(vector<Move> move_list, int ply) const -> vector<Move>;
-  auto OrderMoves(vector<Move> move_list) const -> vector<Move>;
+  auto QuiescenceSearch(int alpha, int beta, int ply) -> int;
 
   auto AddCastlingMoves(vector<Move>& move_list) const -> void;
   auto AddEpMoves(vector<Move>& move_list, S8 moving_player,
                   S8 other_player) const -> void;
+  // Start loading the transposition table and pawn table entries of the
+  // position a move leads to into the cache, so that their miss latency
+  // overlaps with making the move.
+  auto PrefetchMove(const Move& move) const -> void;
   auto AddMovesForPiece(vector<Move>& move_list, Bitboard attack_map,
                         S8 enemy_player, S8 moving_player, S8 moving_piece,
                         S8 start_sq) const -> void;
-  auto CheckSearchTime() const -> void;
+  // Stop the search by throwing OutOfTime if the search time or node limit has
+  // been exceeded.
+  auto CheckSearchLimits() const -> void;
+  // Output and reset the statistics collected during one iteration of
+  // iterative deepening.
+  auto OutputStats(int depth) -> void;
+  // Store the principal variation found by a completed iteration of iterative
+  // deepening, outputting it in verbose mode.
+  auto UpdatePrincipalVariation(int depth, int eval) -> void;
+  // Store the move made at a node followed by the principal variation of its
+  // child as the principal variation of the node.
+  auto UpdatePvTable(const Move& move, int ply) -> void;
   auto ClearHistory() -> void;
+  // Halve all history heuristic scores so that those from previous searches
+  // carry less weight.
+  auto AgeHistoryScores() -> void;
   auto RecordKillerMove(const Move& move, int ply) -> void;
+  // Reward a quiet move which caused a beta cutoff in the history and
+  // counter-move tables, and penalize the quiet moves searched before it.
+  auto RecordQuietCutoff(const Move& move,
+                         const vector<Move>& failed_quiet_moves, int depth,
+                         int ply) -> void;
+  // Apply a "gravity" style update to the history score of a quiet move,
+  // which shrinks as the score approaches kMaxHistoryScore.
+  auto UpdateHistoryScore(const Move& move, S8 player, int bonus) -> void;
 
   Board* board_;
 
@@ -123,9 +303,37 @@ class Engine {
 
   high_resolution_clock::time_point search_start_;
 
-  pair<Move, Move> killer_moves_[kSearchLimit];
-
-  queue<U64> pos_history_;
+  SearchOptions search_options_;
+
+  // Count the nodes visited in the main and quiescence searches.
+  U64 node_count_;
+
+  int search_eval_;
+  int search_depth_;
+
+  SearchStats stats_;
+  U64 prev_iteration_nodes_;
+
+  // Score quiet moves by how often they've caused beta cutoffs, indexed by the
+  // moving player and the start and target squares of the move.
+  int history_scores_[kNumPlayers][kNumSq][kNumSq];
+  // Store the quiet move that last refuted each move, indexed by the player,
+  // piece type, and target square of the refuted move.
+  Move counter_moves_[kNumPlayers][kNumPieceTypes][kNumSq];
+  // Store the state of each ply of the line currently being searched. Every
+  // thread searches with its own engine, so the stack is never shared.
+  SearchStackFrame search_stack_[kMaxSearchPly];
+  // Store the principal variation of each node of the line currently being
+  // searched in a triangular table, where row ply holds the line from the
+  // node at that ply. A node's line is at most one move longer than its
+  // depth, since a table cutoff at a leaf supplies a hash move.
+  Move pv_table_[kSearchLimit + 1][kSearchLimit + 1];
+  int pv_lengths_[kSearchLimit + 1];
+  vector<Move> principal_variation_;
+
+  // Store the hashes of the last positions of the game, followed by those of
+  // the line currently being searched.
+  vector<U64> pos_history_;
 
   S8 user_side_;
 
@@ -137,12 +345,22 @@ class Engine {
 
 inline auto Engine::GetUserSide() const -> S8 { return user_side_; }
 
+inline auto Engine::GetNodeCount() const -> U64 { return node_count_; }
+
+inline auto Engine::GetSearchEval() const -> int { return search_eval_; }
+
+inline auto Engine::GetSearchDepth() const -> int { return search_depth_; }
+
+inline auto Engine::GetPrincipalVariation() const -> const vector<Move>& {
+  return principal_variation_;
+}
+
 inline auto Engine::AddPosToHistory() -> void {
   U64 board_hash = board_->GetBoardHash();
-  pos_history_.push(board_hash);
+  pos_history_.push_back(board_hash);
   // Track the last six positions of the game.
-  while (pos_history_.size() > kSixPlys) {
-    pos_history_.pop();
+  if (pos_history_.size() > kSixPlys) {
+    pos_history_.erase(pos_history_.begin());
   }
 }
 
@@ -166,19 +384,57 @@ inline auto Engine::InEndgame() const -> bool {
                          GetNumSetSq(black_minor_pieces) <= 1));
 }
 
-inline auto Engine::IsKillerMove(const Move& move, int ply) const -> bool {
-  if (ply < 0 || ply >= kSearchLimit) {
-    throw invalid_argument("ply in Engine::IsKillerMove()");
+inline auto Engine::GetCounterMove(int ply) const -> Move {
+  if (ply == 0) {
+    return Move();
+  }
+
+  // Null moves and castling moves aren't refuted by counter moves.
+  const Move& prev_move = search_stack_[ply - 1].current_move;
+  if (prev_move.moving_piece == kNA || prev_move.castling_type != kNA) {
+    return Move();
   }
+  S8 prev_player = GetOtherPlayer(board_->GetPlayerToMove());
+  return counter_moves_[prev_player][prev_move.moving_piece]
+                       [prev_move.target_sq];
+}
+
+inline auto Engine::IsKillerMove(const Move& move, int ply) const -> bool {
+  const Move* killer_moves = search_stack_[ply].killer_moves;
+  return killer_moves[0] == move || killer_moves[1] == move;
+}
 
-  return killer_moves_[ply].first == move || killer_moves_[ply].second == move;
+inline auto Engine::IsLosingCapture(const Move& move) const -> bool {
+  // Skip the exchange evaluation when the captured piece is worth at least as
+  // much as the capturing piece, since the capture can't lose material.
+  if (kPieceVals[move.captured_piece] >= kPieceVals[move.moving_piece]) {
+    return false;
+  }
+  return board_->StaticExchangeEval(move) < 0;
 }
 
 inline auto Engine::RepDetected() const -> bool {
   // Keep track of the last six plys as an efficient approximation to check for
   // board repititions.
-  return pos_history_.size() == kSixPlys &&
-         pos_history_.front() == pos_history_.back();
+  size_t num_positions = pos_history_.size();
+  return num_positions >= kSixPlys &&
+         pos_history_[num_positions - kSixPlys] == pos_history_.back();
+}
+
+inline auto Engine::ProbeTablebase(int& eval) const -> bool {
+  TablebaseResult result;
+  if (search_options_.tablebases == nullptr ||
+      !search_options_.tablebases->Probe(*board_, result)) {
+    return false;
+  }
+  if (result.wdl == kTablebaseWin) {
+    eval = kTablebaseWinEval - result.dtc;
+  } else if (result.wdl == kTablebaseLoss) {
+    eval = result.dtc - kTablebaseWinEval;
+  } else {
+    eval = kNeutralEval;
+  }
+  return true;
 }
 
 inline auto Engine::ZugzwangUnlikely() const -> bool {
@@ -200,7 +456,25 @@ inline auto Engine::NegamaxSearch(int alpha, int beta, int depth, int ply,
                        null_move_allowed, check_time);
 }
 
-inline auto Engine::CheckSearchTime() const -> void {
+inline auto Engine::RootSearch(int prev_eval, int depth, int ply,
+                               Move& best_move) -> int {
+  if (search_options_.search_algorithm == kAspirationPvs) {
+    return AspirationSearch(prev_eval, depth, ply, best_move);
+  }
+  return MtdfSearch(prev_eval, depth, ply, best_move);
+}
+
+inline auto Engine::CheckSearchLimits() const -> void {
+  if (search_options_.node_limit > 0 &&
+      node_count_ >= search_options_.node_limit) {
+    throw OutOfTime();
+  }
+
+  // Ignore the search time when searching to a fixed depth.
+  if (search_options_.depth_limit > 0) {
+    return;
+  }
+
   float time_since_search_started =
       duration_cast<duration<float>>(high_resolution_clock::now() -
                                      search_start_)
@@ -210,15 +484,51 @@ inline auto Engine::CheckSearchTime() const -> void {
   }
 }
 
-inline auto Engine::ClearHistory() -> void {
-  queue<U64> cleared_history;
-  pos_history_.swap(cleared_history);
+inline auto Engine::ClearHistory() -> void { pos_history_.clear(); }
+
+inline auto Engine::AgeHistoryScores() -> void {
+  for (auto& player_scores : history_scores_) {
+    for (auto& start_sq_scores : player_scores) {
+      for (int& score : start_sq_scores) {
+        score /= 2;
+      }
+    }
+  }
+}
+
+inline auto Engine::UpdateHistoryScore(const Move& move, S8 player, int bonus)
+    -> void {
+  int& score = history_scores_[player][move.start_sq][move.target_sq];
+  score += bonus - score * abs(bonus) / kMaxHistoryScore;
+}
+
+inline auto Engine::GetPvMove(int ply) const -> Move {
+  if (!search_stack_[ply].on_pv ||
+      static_cast<size_t>(ply) >= principal_variation_.size()) {
+    return Move();
+  }
+  return principal_variation_[ply];
+}
+
+inline auto Engine::UpdatePvTable(const Move& move, int ply) -> void {
+  pv_table_[ply][0] = move;
+  int child_pv_length = pv_lengths_[ply + 1];
+  copy(pv_table_[ply + 1], pv_table_[ply + 1] + child_pv_length,
+       pv_table_[ply] + 1);
+  pv_lengths_[ply] = child_pv_length + 1;
+}
+
+inline auto Engine::PrefetchMove(const Move& move) const -> void {
+  U64 child_pawn_hash;
+  transposition_table_.Prefetch(board_->GetChildHash(move, child_pawn_hash));
+  board_->PrefetchPawnEntry(child_pawn_hash);
 }
 
 inline auto Engine::RecordKillerMove(const Move& move, int ply) -> void {
-  if (move != killer_moves_[ply].first) {
-    killer_moves_[ply].second = killer_moves_[ply].first;
-    killer_moves_[ply].first = move;
+  Move* killer_moves = search_stack_[ply].killer_moves;
+  if (move != killer_moves[0]) {
+    killer_moves[1] = killer_moves[0];
+    killer_moves[0] = move;
   }
 }
 
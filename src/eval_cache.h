@@ -0,0 +1,98 @@
+/* Noah Himed
+ *
+ * Define and implement the EvalCache type, a hash table storing the static
+ * evaluations of whole positions so that positions reached again, which is
+ * common in the quiescence search, aren't evaluated twice. Each board owns its
+ * cache, so searches on different threads never share one and no locking is
+ * needed.
+ *
+ * Licensed under MIT License. Terms and conditions enclosed in "LICENSE.txt".
+ */
+
+#ifndef OMEGAZERO_SRC_EVAL_CACHE_H_
+#define OMEGAZERO_SRC_EVAL_CACHE_H_
+
+#include <vector>
+
+#include "move.h"
+#include "search_stats.h"
+
+namespace omegazero {
+
+using std::vector;
+
+constexpr int kEvalCacheSize = 1 << 16;
+// Store a mask with the least significant 16 bits set for computing table
+// indices.
+constexpr U64 kEvalCacheHashMask = kEvalCacheSize - 1;
+
+class EvalCache {
+ public:
+  EvalCache();
+
+  // Look up the position in the cache and set eval to its evaluation if the
+  // position is found. Return a bool to indicate if the position was found.
+  // Positions are keyed by their board hash combined with any evaluation
+  // state the hash leaves out.
+  auto Access(U64 key, int& eval) const -> bool;
+
+  auto Update(U64 key, int eval) -> void;
+  auto Clear() -> void;
+
+  // Return the number of probes and hits recorded since the last call to
+  // ResetStats(). These are only recorded in builds with search statistics.
+  auto GetNumProbes() const -> U64;
+  auto GetNumHits() const -> U64;
+  auto ResetStats() -> void;
+
+ private:
+  mutable U64 num_probes_ = 0;
+  mutable U64 num_hits_ = 0;
+
+  struct TableEntry {
+    U64 key;
+    int eval;
+    bool occupied = false;
+  };
+
+  vector<TableEntry> entries_;
+};
+
+inline EvalCache::EvalCache() { entries_.resize(kEvalCacheSize); }
+
+inline auto EvalCache::Access(U64 key, int& eval) const -> bool {
+  RecordStat(num_probes_);
+  const TableEntry& entry = entries_[key & kEvalCacheHashMask];
+  if (entry.occupied && entry.key == key) {
+    eval = entry.eval;
+    RecordStat(num_hits_);
+    return true;
+  }
+  return false;
+}
+
+inline auto EvalCache::Update(U64 key, int eval) -> void {
+  TableEntry& entry = entries_[key & kEvalCacheHashMask];
+  entry.key = key;
+  entry.eval = eval;
+  entry.occupied = true;
+}
+
+inline auto EvalCache::Clear() -> void {
+  for (TableEntry& entry : entries_) {
+    entry.occupied = false;
+  }
+}
+
+inline auto EvalCache::GetNumProbes() const -> U64 { return num_probes_; }
+
+inline auto EvalCache::GetNumHits() const -> U64 { return num_hits_; }
+
+inline auto EvalCache::ResetStats() -> void {
+  num_probes_ = 0;
+  num_hits_ = 0;
+}
+
+}  // namespace omegazero
+
+#endif  // OMEGAZERO_SRC_EVAL_CACHE_H_
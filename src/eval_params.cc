@@ -0,0 +1,141 @@
+/* Noah Himed
+ *
+ * Implement loading and writing evaluation weights.
+ *
+ * Licensed under MIT License. Terms and conditions enclosed in "LICENSE.txt".
+ */
+
+#include "eval_params.h"
+
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "board.h"
+
+namespace omegazero {
+
+using std::getline;
+using std::ifstream;
+using std::invalid_argument;
+using std::istringstream;
+using std::ofstream;
+using std::string;
+using std::vector;
+
+namespace {
+
+// Store the name of a weight in the text format and where its values are.
+struct ParamField {
+  string name;
+  int* values;
+  int num_values;
+};
+
+auto GetParamFields(EvalParams& eval_params) -> vector<ParamField> {
+  vector<ParamField> fields = {
+      {"piece_vals", eval_params.piece_vals, kNumPieceTypes}};
+  const char* kPieceNames[kNumPieceTypes] = {"pawn", "knight", "bishop",
+                                             "rook", "queen",  "king"};
+  for (S8 piece = kPawn; piece <= kKing; ++piece) {
+    fields.push_back({string(kPieceNames[piece]) + "_sq_table",
+                      eval_params.piece_sq_tables[piece], kNumSq});
+  }
+  fields.push_back({"endgame_king_sq_table",
+                    eval_params.endgame_king_piece_sq_table, kNumSq});
+  fields.push_back({"bishop_pair_bonus", &eval_params.bishop_pair_bonus, 1});
+  fields.push_back(
+      {"connected_rook_bonus", &eval_params.connected_rook_bonus, 1});
+  fields.push_back({"castling_rights_loss_penalty",
+                    &eval_params.castling_rights_loss_penalty, 1});
+  fields.push_back(
+      {"backward_pawn_penalty", &eval_params.backward_pawn_penalty, 1});
+  fields.push_back(
+      {"doubled_pawn_penalty", &eval_params.doubled_pawn_penalty, 1});
+  fields.push_back(
+      {"isolated_pawn_penalty", &eval_params.isolated_pawn_penalty, 1});
+  fields.push_back({"neighbor_bonus", &eval_params.neighbor_bonus, 1});
+  fields.push_back({"defender_bonus", &eval_params.defender_bonus, 1});
+  fields.push_back({"rook_behind_passed_pawn_bonus",
+                    &eval_params.rook_behind_passed_pawn_bonus, 1});
+  fields.push_back(
+      {"passed_pawn_bonuses", eval_params.passed_pawn_bonuses, kNumRanks});
+  fields.push_back({"king_pawn_shield_hole_penalty",
+                    &eval_params.king_pawn_shield_hole_penalty, 1});
+  return fields;
+}
+
+}  // namespace
+
+auto LoadEvalParams(const string& params_path) -> EvalParams {
+  ifstream params_f(params_path);
+  if (!params_f.is_open()) {
+    throw invalid_argument("Evaluation parameter file can't be opened");
+  }
+
+  EvalParams eval_params = kDefaultEvalParams;
+  vector<ParamField> fields = GetParamFields(eval_params);
+  string line;
+  while (getline(params_f, line)) {
+    istringstream line_stream(line);
+    string name;
+    if (!(line_stream >> name) || name[0] == '#') {
+      continue;
+    }
+    auto field = fields.begin();
+    while (field != fields.end() && field->name != name) {
+      ++field;
+    }
+    if (field == fields.end()) {
+      throw invalid_argument("unknown evaluation parameter \"" + name + "\"");
+    }
+
+    // Tables may continue over several lines, so read values until the field
+    // is filled.
+    for (int value_idx = 0; value_idx < field->num_values; ++value_idx) {
+      while (!(line_stream >> field->values[value_idx])) {
+        if (!line_stream.eof() || !getline(params_f, line)) {
+          throw invalid_argument("values of evaluation parameter \"" + name +
+                                 "\"");
+        }
+        line_stream.clear();
+        line_stream.str(line);
+      }
+    }
+    string extra_value;
+    if (line_stream >> extra_value) {
+      throw invalid_argument("values of evaluation parameter \"" + name +
+                             "\"");
+    }
+  }
+  return eval_params;
+}
+
+auto WriteEvalParams(const string& params_path, const EvalParams& eval_params,
+                     const string& comment) -> void {
+  ofstream params_f(params_path);
+  if (!params_f.is_open()) {
+    throw invalid_argument("Evaluation parameter file can't be opened");
+  }
+
+  istringstream comment_stream(comment);
+  string comment_line;
+  while (getline(comment_stream, comment_line)) {
+    params_f << "# " << comment_line << "\n";
+  }
+  EvalParams written_params = eval_params;
+  for (const ParamField& field : GetParamFields(written_params)) {
+    params_f << field.name;
+    // Write tables with one rank per line.
+    bool is_table = field.num_values == kNumSq;
+    for (int value_idx = 0; value_idx < field.num_values; ++value_idx) {
+      params_f << ((is_table && value_idx % kNumFiles == 0) ? "\n " : " ")
+               << field.values[value_idx];
+    }
+    params_f << "\n";
+  }
+}
+
+}  // namespace omegazero
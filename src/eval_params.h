@@ -0,0 +1,141 @@
+/* Noah Himed
+ *
+ * Define the EvalParams type, the table of weights read by the evaluation
+ * function, along with its default values and a text format for loading
+ * alternative weights at runtime.
+ *
+ * Licensed under MIT License. Terms and conditions enclosed in "LICENSE.txt".
+ */
+
+#ifndef OMEGAZERO_SRC_EVAL_PARAMS_H_
+#define OMEGAZERO_SRC_EVAL_PARAMS_H_
+
+#include <string>
+
+#include "board.h"
+
+namespace omegazero {
+
+// Store the weights of the evaluation function in centipawns. Piece square
+// tables are defined for White, with Black using mirrored values, and are
+// entered in LERF order.
+struct EvalParams {
+  // Store the piece values used by the evaluation. The search uses kPieceVals
+  // instead, so that tuning the evaluation doesn't change move ordering.
+  int piece_vals[kNumPieceTypes];
+  int piece_sq_tables[kNumPieceTypes][kNumSq];
+  // Store the king piece square table used in the endgame. The king's position
+  // is tapered from the middlegame table to this one by the game phase.
+  int endgame_king_piece_sq_table[kNumSq];
+
+  int bishop_pair_bonus;
+  int connected_rook_bonus;
+  int castling_rights_loss_penalty;
+
+  // Store pawn structure bonuses and penalties.
+  int backward_pawn_penalty;
+  int doubled_pawn_penalty;
+  int isolated_pawn_penalty;
+  int neighbor_bonus;
+  int defender_bonus;
+  int rook_behind_passed_pawn_bonus;
+  // Store the passed pawn bonus of each rank.
+  int passed_pawn_bonuses[kNumRanks];
+  int king_pawn_shield_hole_penalty;
+};
+
+// Store the default weights, which the evaluation reads as compile time
+// constants unless other weights are loaded.
+constexpr EvalParams kDefaultEvalParams = {
+    /*piece_vals=*/{100, 320, 330, 500, 900, 20000},
+    /*piece_sq_tables=*/{
+        // Define the pawn piece square table.
+        {0, 0, 0, 0, 0, 0, 0, 0,
+         5, 10, 10, -20, -20, 10, 10, 5,
+         5, -5, -10, 0, 0, -10, -5, 5,
+         0, 0, 0, 20, 20, 0, 0, 0,
+         5, 5, 10, 25, 25, 10, 5, 5,
+         10, 10, 20, 30, 30, 20, 10, 10,
+         50, 50, 50, 50, 50, 50, 50, 50,
+         0, 0, 0, 0, 0, 0, 0, 0},
+        // Define the knight piece square table.
+        {-50, -40, -30, -30, -30, -30, -40, -50,
+         -40, -20, 0, 5, 5, 0, -20, -40,
+         -30, 5, 10, 15, 15, 10, 5, -30,
+         -30, 0, 15, 20, 20, 15, 0, -30,
+         -30, 5, 15, 20, 20, 15, 5, -30,
+         -30, 0, 10, 15, 15, 10, 0, -30,
+         -40, -20, 0, 0, 0, 0, -20, -40,
+         -50, -40, -30, -30, -30, -30, -40, -50},
+        // Define the bishop piece square table.
+        {-20, -10, -10, -10, -10, -10, -10, -20,
+         -10, 5, 0, 0, 0, 0, 5, -10,
+         -10, 10, 10, 10, 10, 10, 10, -10,
+         -10, 0, 10, 10, 10, 10, 0, -10,
+         -10, 5, 5, 10, 10, 5, 5, -10,
+         -10, 0, 5, 10, 10, 5, 0, -10,
+         -10, 0, 0, 0, 0, 0, 0, -10,
+         -20, -10, -10, -10, -10, -10, -10, -20},
+        // Define the rook piece square table.
+        {0, 0, 0, 5, 5, 0, 0, 0,
+         -5, 0, 0, 0, 0, 0, 0, -5,
+         -5, 0, 0, 0, 0, 0, 0, -5,
+         -5, 0, 0, 0, 0, 0, 0, -5,
+         -5, 0, 0, 0, 0, 0, 0, -5,
+         -5, 0, 0, 0, 0, 0, 0, -5,
+         5, 10, 10, 10, 10, 10, 10, 5,
+         0, 0, 0, 0, 0, 0, 0, 0},
+        // Define the queen piece square table.
+        {-20, -10, -10, -5, -5, -10, -10, -30,
+         0, 5, 0, 0, 0, 0, -10, -10,
+         5, 5, 5, 5, 5, 0, -10, 0,
+         0, 5, 5, 5, 5, 0, -5, -5,
+         0, 5, 5, 5, 5, 0, -5, -10,
+         0, 5, 5, 5, 5, 0, -10, -10,
+         0, 0, 0, 0, 0, 0, -10, -20,
+         -10, -10, -5, -5, -10, -10, -20, 0},
+        // Define the king piece square table.
+        {20, 30, 10, 0, 0, 10, 30, 20,
+         20, 20, 0, 0, 0, 0, 20, 20,
+         -10, -20, -20, -20, -20, -20, -20, -10,
+         -20, -30, -30, -40, -40, -30, -30, -20,
+         -30, -40, -40, -50, -50, -40, -40, -30,
+         -30, -40, -40, -50, -50, -40, -40, -30,
+         -30, -40, -40, -50, -50, -40, -40, -30,
+         -30, -40, -40, -50, -50, -40, -40, -30}},
+    /*endgame_king_piece_sq_table=*/{
+        -50, -30, -30, -30, -30, -30, -30, -50,
+        -30, -30, 0, 0, 0, 0, -30, -30,
+        -30, -10, 20, 30, 30, 20, -10, -30,
+        -30, -10, 30, 40, 40, 30, -10, -30,
+        -30, -10, 30, 40, 40, 30, -10, -30,
+        -30, -10, 20, 30, 30, 20, -10, -30,
+        -30, -20, -10, 0, 0, -10, -20, -30,
+        -50, -40, -30, -20, -20, -30, -40, -50},
+    /*bishop_pair_bonus=*/12,
+    /*connected_rook_bonus=*/25,
+    /*castling_rights_loss_penalty=*/6,
+    /*backward_pawn_penalty=*/1,
+    /*doubled_pawn_penalty=*/7,
+    /*isolated_pawn_penalty=*/2,
+    /*neighbor_bonus=*/1,
+    /*defender_bonus=*/2,
+    /*rook_behind_passed_pawn_bonus=*/12,
+    /*passed_pawn_bonuses=*/{3, 8, 13, 18, 23, 28, 33, 0},
+    /*king_pawn_shield_hole_penalty=*/4,
+};
+
+// Read evaluation weights from a text file, starting from the default weights.
+// Each line names a weight followed by its values (ex: "bishop_pair_bonus 12"
+// or "knight_sq_table" followed by 64 values), and lines starting with '#' are
+// comments.
+auto LoadEvalParams(const std::string& params_path) -> EvalParams;
+// Write every evaluation weight in the format read by LoadEvalParams(),
+// preceded by a comment.
+auto WriteEvalParams(const std::string& params_path,
+                     const EvalParams& eval_params, const std::string& comment)
+    -> void;
+
+}  // namespace omegazero
+
+#endif  // OMEGAZERO_SRC_EVAL_PARAMS_H_
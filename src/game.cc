@@ -7,21 +7,29 @@
 
 #include "game.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <cctype>
+#include <cstddef>
 #include <ctime>
 #include <fstream>
 #include <iostream>
 #include <iterator>
-#include <random>
+#include <map>
+#include <memory>
+#include <sstream>
 #include <stack>
 #include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "bad_move.h"
 #include "board.h"
 #include "engine.h"
 #include "move.h"
+#include "opening_book.h"
+#include "perf_counters.h"
 
 namespace omegazero {
 
@@ -31,13 +39,146 @@ using std::endl;
 using std::ifstream;
 using std::invalid_argument;
 using std::ios;
-using std::mt19937;
+using std::istream;
+using std::istringstream;
+using std::make_unique;
+using std::map;
+using std::min;
 using std::ofstream;
-using std::random_device;
+using std::pair;
+using std::remove;
 using std::string;
-using std::uniform_int_distribution;
+using std::unique_ptr;
 using std::vector;
 
+namespace {
+
+// Limit the number of moves from each line or game added to opening books.
+// The longest line in p3ECO.txt is 39 plies.
+constexpr size_t kMaxBookPly = 40;
+
+// Read the next line of a text file of opening lines, such as p3ECO.txt, into
+// a list of moves. Lines begin with the first move ("1.") and may continue onto
+// several lines of the file, until the "1/2" that ends them. Return false once
+// no lines are left.
+auto ReadEcoLine(istream& eco_f, vector<string>& move_strs) -> bool {
+  move_strs.clear();
+  string f_line;
+  string opening_line;
+  while (getline(eco_f, f_line)) {
+    // Remove the carriage return at the end of lines with Windows line
+    // endings.
+    if (!f_line.empty() && f_line.back() == '\r') {
+      f_line.pop_back();
+    }
+    if (opening_line.empty() && f_line.rfind("1.", 0) == string::npos) {
+      continue;
+    }
+    opening_line += f_line + " ";
+    if (f_line.find("1/2") == string::npos) {
+      continue;
+    }
+
+    istringstream opening_line_stream(opening_line);
+    string move_str;
+    while (opening_line_stream >> move_str && move_str != "1/2") {
+      // Skip comments, and remove move numbers (ex: the "1." in "1.e4").
+      if (move_str.front() == '{') {
+        continue;
+      }
+      move_str = move_str.substr(move_str.find('.') + 1);
+      if (!move_str.empty()) {
+        move_strs.push_back(move_str);
+      }
+    }
+    return true;
+  }
+  return false;
+}
+
+// Read the main line of the next game in a PGN file into a list of moves,
+// skipping tag pairs, comments, variations, and numeric annotation glyphs.
+// Return false once no games are left.
+auto ReadPgnGame(istream& pgn_f, vector<string>& move_strs) -> bool {
+  move_strs.clear();
+  string token;
+  int variation_depth = 0;
+  // Add the finished token to the moves if it is a move of the main line.
+  // Return true if the token is the result that ends the game.
+  auto end_token = [&]() {
+    bool is_result = token == "1-0" || token == "0-1" || token == "1/2-1/2" ||
+                     token == "*";
+    if (variation_depth == 0 && !is_result) {
+      // Remove move numbers (ex: the "1." in "1.e4" or the "1..." in
+      // "1...e5").
+      token = token.substr(token.find_last_of('.') + 1);
+      if (!token.empty() && token.front() != '$') {
+        move_strs.push_back(token);
+      }
+    }
+    token.clear();
+    return variation_depth == 0 && is_result;
+  };
+
+  char ch;
+  while (pgn_f.get(ch)) {
+    if (ch == '{' || ch == '[' || ch == ';') {
+      // Skip comments and tag pairs, which may hold any characters.
+      if (!token.empty() && end_token()) {
+        return true;
+      }
+      char end_ch = (ch == '{') ? '}' : (ch == '[') ? ']' : '\n';
+      while (pgn_f.get(ch) && ch != end_ch) {
+      }
+    } else if (ch == '(' || ch == ')') {
+      if (!token.empty() && end_token()) {
+        return true;
+      }
+      variation_depth += (ch == '(') ? 1 : -1;
+    } else if (isspace(static_cast<unsigned char>(ch))) {
+      if (!token.empty() && end_token()) {
+        return true;
+      }
+    } else {
+      token += ch;
+    }
+  }
+  // Keep a final game that is missing its result.
+  if (!token.empty()) {
+    end_token();
+  }
+  return !move_strs.empty();
+}
+
+// Convert a move in standard algebraic notation to the notation read by
+// Game::ParseMoveCmd(), removing check and annotation symbols (ex: "Nf3+!"
+// becomes "Nf3") and the "=" of promotions, writing castling with zeros, and
+// marking pawn captures onto the en passent target square with "e.p.".
+auto NormalizeSanMove(string move_str, S8 ep_target_sq) -> string {
+  while (!move_str.empty() &&
+         (move_str.back() == '+' || move_str.back() == '#' ||
+          move_str.back() == '!' || move_str.back() == '?')) {
+    move_str.pop_back();
+  }
+  move_str.erase(remove(move_str.begin(), move_str.end(), '='),
+                 move_str.end());
+  if (move_str == "O-O") {
+    return "0-0";
+  }
+  if (move_str == "O-O-O") {
+    return "0-0-0";
+  }
+  if (ep_target_sq != kNA && move_str.length() == 4 && move_str[0] >= 'a' &&
+      move_str[0] <= 'h' && move_str[1] == 'x' &&
+      move_str[2] - 'a' == GetFileFromSq(ep_target_sq) &&
+      move_str[3] - '1' == GetRankFromSq(ep_target_sq)) {
+    move_str += "e.p.";
+  }
+  return move_str;
+}
+
+}  // namespace
+
 auto GetPieceLetter(S8 piece) -> char {
   switch (piece) {
     case kKnight:
@@ -77,11 +218,59 @@ auto GetPieceType(char piece_ch) -> S8 {
   }
 }
 
+auto GetUciMoveStr(const Move& move, S8 moving_player) -> string {
+  string move_str;
+  if (move.castling_type == kNA) {
+    move_str += static_cast<char>('a' + GetFileFromSq(move.start_sq));
+    move_str += static_cast<char>('1' + GetRankFromSq(move.start_sq));
+    move_str += static_cast<char>('a' + GetFileFromSq(move.target_sq));
+    move_str += static_cast<char>('1' + GetRankFromSq(move.target_sq));
+
+    if (move.promoted_to_piece != kNA) {
+      switch (move.promoted_to_piece) {
+        case kKnight:
+          move_str += 'n';
+          break;
+        case kBishop:
+          move_str += 'b';
+          break;
+        case kRook:
+          move_str += 'r';
+          break;
+        case kQueen:
+          move_str += 'q';
+          break;
+        default:
+          throw invalid_argument(
+              "move.promoted_to_piece in GetUciMoveStr()");
+      }
+    }
+  } else if (move.castling_type == kQueenSide) {
+    if (moving_player == kWhite) {
+      move_str = "e1c1";
+    } else {
+      move_str = "e8c8";
+    }
+  } else if (move.castling_type == kKingSide) {
+    if (moving_player == kWhite) {
+      move_str = "e1g1";
+    } else {
+      move_str = "e8g8";
+    }
+  } else {
+    throw invalid_argument("move.castling_type in GetUciMoveStr()");
+  }
+  return move_str;
+}
+
 Game::Game(const string& init_pos, const string& opening_book_path,
-           char player_side, float search_time, bool on_opening)
-    : board_(init_pos), engine_(&board_, player_side, search_time) {
+           char player_side, float search_time, bool on_opening,
+           const SearchOptions& search_options)
+    : board_(init_pos),
+      engine_(&board_, player_side, search_time, search_options) {
   game_active_ = true;
   on_opening_ = on_opening;
+  verbose_ = search_options.verbose;
   search_time_ = search_time;
   turn_num_ = 1;
   winner_ = kNA;
@@ -98,38 +287,17 @@ Game::Game(const string& init_pos, const string& opening_book_path,
   piece_symbols_[kBlack][kQueen] = "♛";
   piece_symbols_[kBlack][kKing] = "♚";
 
-  // Initialize the opening book with the opening book text file.
-  ifstream opening_book_f(opening_book_path);
-  if (opening_book_f.is_open()) {
-    string f_line;
-    string opening_line;
-    while (getline(opening_book_f, f_line)) {
-      if (f_line.rfind("1.", 0) != string::npos) {
-        for (;;) {
-          // Remove the newline character at the end of the line.
-          f_line.pop_back();
-          opening_line += f_line;
-          // Check if the last three characters of the line are "1/2".
-          if (opening_line.substr(opening_line.length() - 3) == "1/2") {
-            // Add the current opening to the opening book.
-            opening_book_.push_back(opening_line);
-            opening_line.clear();
-            // Start looking for the next opening.
-            break;
-          }
-          // Add on to a current opening.
-          getline(opening_book_f, f_line);
-        }
-      }
-    }
-    opening_book_f.close();
-  } else {
-    throw invalid_argument("Opening book can't be opened");
+  // Memory map the binary opening book only if the game begins in the
+  // starting position.
+  if (on_opening_) {
+    opening_book_.Open(opening_book_path);
   }
 }
 
 auto Game::MakeEngineMove() -> Move {
-  DisplayBoard();
+  if (verbose_) {
+    DisplayBoard();
+  }
 
   // Record the current board state to enforce move repitition rules.
   RecordBoardState();
@@ -143,14 +311,19 @@ auto Game::MakeEngineMove() -> Move {
   S8 player_to_move = board_.GetPlayerToMove();
   if (game_status == kPlayerInCheck) {
     // Inform the user that a player is in check.
-    cout << GetPlayerStr(player_to_move) << " is in check" << endl;
-  } else if (game_status == kDraw || pos_history_[board_] == kMaxMoveRep) {
+    if (verbose_) {
+      cout << GetPlayerStr(player_to_move) << " is in check" << endl;
+    }
+  } else if (game_status == kDraw ||
+             pos_history_[board_.GetBoardHash()] == kMaxMoveRep) {
     // End the game if a draw has occured.
     game_active_ = false;
     return engine_move;
   } else if (game_status == kPlayerCheckmated) {
     // Inform the user that a player has been mated.
-    cout << GetPlayerStr(player_to_move) << " has been checkmated" << endl;
+    if (verbose_) {
+      cout << GetPlayerStr(player_to_move) << " has been checkmated" << endl;
+    }
     game_active_ = false;
     winner_ = GetOtherPlayer(player_to_move);
     return engine_move;
@@ -158,9 +331,11 @@ auto Game::MakeEngineMove() -> Move {
 
   engine_move = engine_.GetBestMove();
 
-  cout << "\n\n"
-       << GetPlayerStr(player_to_move)
-       << "'s move: " << GetFideMoveStr(engine_move) << endl;
+  if (verbose_) {
+    cout << "\n\n"
+         << GetPlayerStr(player_to_move)
+         << "'s move: " << GetFideMoveStr(engine_move) << endl;
+  }
   board_.MakeMove(engine_move);
   return engine_move;
 }
@@ -176,14 +351,19 @@ auto Game::MakeOtherEngineMove(const Move& move) -> void {
   S8 player_to_move = board_.GetPlayerToMove();
   if (game_status == kPlayerInCheck) {
     // Inform the user that a player is in check.
-    cout << GetPlayerStr(player_to_move) << " is in check" << endl;
-  } else if (game_status == kDraw || pos_history_[board_] == kMaxMoveRep) {
+    if (verbose_) {
+      cout << GetPlayerStr(player_to_move) << " is in check" << endl;
+    }
+  } else if (game_status == kDraw ||
+             pos_history_[board_.GetBoardHash()] == kMaxMoveRep) {
     // End the game if a draw has occured.
     game_active_ = false;
     return;
   } else if (game_status == kPlayerCheckmated) {
     // Inform the user that a player has been mated.
-    cout << GetPlayerStr(player_to_move) << " has been checkmated" << endl;
+    if (verbose_) {
+      cout << GetPlayerStr(player_to_move) << " has been checkmated" << endl;
+    }
     game_active_ = false;
     winner_ = GetOtherPlayer(player_to_move);
     return;
@@ -194,48 +374,79 @@ auto Game::MakeOtherEngineMove(const Move& move) -> void {
 
 auto Game::GetOpeningMove(Move& opening_move) -> bool {
   if (on_opening_) {
-    string opening_line;
-    // Remove all irrelevant opening lines.
-    int last_opening_line_idx = static_cast<int>(opening_book_.size()) - 1;
-    for (int opening_line_idx = last_opening_line_idx; opening_line_idx >= 0;
-         --opening_line_idx) {
-      opening_line = opening_book_[opening_line_idx];
-      // If an opening doesn't match the move history or has no moves left,
-      // remove it as an option.
-      if (opening_line.rfind(move_history_, 0) == string::npos ||
-          opening_line.substr(move_history_.size(), 3) == "1/2") {
-        opening_book_.erase(opening_book_.begin() + opening_line_idx);
+    U16 book_move;
+    on_opening_ = opening_book_.GetBookMove(board_.GetBoardHash(), book_move);
+    if (on_opening_) {
+      // Find the pseudo-legal move matching the book move. A book move won't
+      // have a match in the rare case of a hash collision.
+      S8 player_to_move = board_.GetPlayerToMove();
+      on_opening_ = false;
+      for (const Move& move : engine_.GenerateMoves()) {
+        if (EncodeBookMove(move, player_to_move) == book_move) {
+          opening_move = move;
+          on_opening_ = true;
+          break;
+        }
       }
     }
+  }
+  return on_opening_;
+}
 
-    // Get next move string.
-    int num_opening_lines = static_cast<int>(opening_book_.size());
-    if (num_opening_lines > 0) {
-      // Pick a random valid opening line.
-      random_device dev;
-      mt19937 rng(dev());
-      uniform_int_distribution<mt19937::result_type> opening_line_rand_dist(
-          0, num_opening_lines - 1);
-      size_t opening_line_idx = opening_line_rand_dist(rng);
-      string rand_opening_line = opening_book_[opening_line_idx];
-
-      // Extract the next move from the line.
-      size_t move_start_idx;
-      if (board_.GetPlayerToMove() == kWhite) {
-        move_start_idx = rand_opening_line.find(".", move_history_.size()) + 1;
-      } else {
-        move_start_idx = move_history_.size();
+auto Game::BuildOpeningBook(const string& lines_path,
+                            const string& book_path) -> void {
+  ifstream lines_f(lines_path);
+  if (!lines_f.is_open()) {
+    throw invalid_argument("Opening line file can't be opened");
+  }
+  constexpr char kPgnExtension[] = ".pgn";
+  constexpr size_t kPgnExtensionLen = sizeof(kPgnExtension) - 1;
+  bool is_pgn = lines_path.length() >= kPgnExtensionLen &&
+                lines_path.compare(lines_path.length() - kPgnExtensionLen,
+                                   kPgnExtensionLen, kPgnExtension) == 0;
+
+  // Count the number of lines each move is played in from each position.
+  map<pair<U64, U16>, U32> book_move_counts;
+  vector<string> move_strs;
+  int num_truncated_lines = 0;
+  board_.SavePos();
+  while (is_pgn ? ReadPgnGame(lines_f, move_strs)
+                : ReadEcoLine(lines_f, move_strs)) {
+    size_t num_book_moves = min(move_strs.size(), kMaxBookPly);
+    for (size_t move_idx = 0; move_idx < num_book_moves; ++move_idx) {
+      U64 board_hash = board_.GetBoardHash();
+      S8 player_to_move = board_.GetPlayerToMove();
+      Move move;
+      try {
+        move = ParseMoveCmd(
+            NormalizeSanMove(move_strs[move_idx], board_.GetEpTargetSq()));
+        board_.MakeMove(move);
+      } catch (BadMove& e) {
+        // Keep the moves leading up to a move that can't be played.
+        ++num_truncated_lines;
+        break;
       }
-      size_t move_str_len =
-          rand_opening_line.find(" ", move_start_idx) - move_start_idx;
-      string opening_move_str =
-          rand_opening_line.substr(move_start_idx, move_str_len);
-      opening_move = ParseMoveCmd(opening_move_str);
-    } else {
-      on_opening_ = false;
+      ++book_move_counts[{board_hash, EncodeBookMove(move, player_to_move)}];
     }
+    board_.ResetPos();
   }
-  return on_opening_;
+  lines_f.close();
+
+  vector<BookEntry> book_entries;
+  book_entries.reserve(book_move_counts.size());
+  constexpr U32 kMaxBookWeight = UINT16_MAX;
+  for (const auto& [pos_move, move_count] : book_move_counts) {
+    BookEntry book_entry;
+    book_entry.key = pos_move.first;
+    book_entry.move = pos_move.second;
+    book_entry.weight = static_cast<U16>(min(move_count, kMaxBookWeight));
+    book_entry.learn = 0;
+    book_entries.push_back(book_entry);
+  }
+  WriteOpeningBook(book_entries, book_path);
+  cout << "Wrote " << book_entries.size() << " book entries to " << book_path
+       << " (" << num_truncated_lines << " lines truncated at an unplayable move)"
+       << endl;
 }
 
 void Game::Play() {
@@ -254,12 +465,14 @@ void Game::Play() {
   if (game_status == kPlayerInCheck) {
     // Inform the user that a player is in check.
     cout << GetPlayerStr(player_to_move) << " is in check" << endl;
-  } else if (game_status == kDraw || pos_history_[board_] == kMaxMoveRep) {
+  } else if (game_status == kDraw ||
+             pos_history_[board_.GetBoardHash()] == kMaxMoveRep) {
     // End the game if a draw has occured.
     game_active_ = false;
     RecordFinalScore();
     return;
-  } else if (pos_history_[board_] == kNumMoveRepForOptionalDraw &&
+  } else if (pos_history_[board_.GetBoardHash()] ==
+                 kNumMoveRepForOptionalDraw &&
              player_to_move != user_side) {
     // Inform the human user of an optional draw. Do not give the engine the
     // option to draw if it may legally continue playing.
@@ -331,7 +544,8 @@ auto Game::Save(string game_record_file) -> void {
   }
 }
 
-auto Game::Test(int depth) -> void {
+auto Game::Test(int depth, bool show_breakdown, bool count_perf_events)
+    -> void {
   if (depth < 1) {
     throw invalid_argument("Perft depth must be at least one");
   }
@@ -339,10 +553,19 @@ auto Game::Test(int depth) -> void {
   Move user_move;
   string user_cmd;
   U64 subtree_node_count;
-  U64 total_node_count = 0;
+  U64 total_node_count;
+  high_resolution_clock::time_point start;
+  unique_ptr<PerfCounters> perf_counters;
 RunPerft:
   DisplayBoard();
   cout << endl;
+  total_node_count = 0;
+  if (count_perf_events) {
+    // Open new counters for each walk of the tree.
+    perf_counters = make_unique<PerfCounters>();
+    perf_counters->Start();
+  }
+  start = high_resolution_clock::now();
   // Generate a list of pseudo-legal moves.
   vector<Move> move_list = engine_.GenerateMoves();
   for (const Move& move : move_list) {
@@ -354,9 +577,37 @@ RunPerft:
     }
     subtree_node_count = engine_.Perft(depth - 1);
     board_.UnmakeMove(move);
-    cout << GetUciMoveStr(move) << ": " << subtree_node_count << endl;
+    cout << GetUciMoveStr(move, board_.GetPlayerToMove()) << ": "
+         << subtree_node_count << endl;
     total_node_count += subtree_node_count;
   }
+  float perft_time =
+      duration_cast<duration<float>>(high_resolution_clock::now() - start)
+          .count();
+  if (perf_counters) {
+    perf_counters->Stop();
+  }
+  cout << "\nNodes: " << total_node_count << endl;
+  U64 nodes_per_sec =
+      (perft_time > 0.0f)
+          ? static_cast<U64>(static_cast<float>(total_node_count) / perft_time)
+          : 0;
+  cout << "Nodes/second: " << nodes_per_sec << endl;
+  if (perf_counters) {
+    perf_counters->Output(total_node_count);
+  }
+
+  if (show_breakdown) {
+    // Count the leaves again by move type, making each leaf move.
+    PerftCounts counts;
+    engine_.Perft(depth, counts);
+    cout << "Captures: " << counts.captures << endl;
+    cout << "E.p.: " << counts.eps << endl;
+    cout << "Castles: " << counts.castles << endl;
+    cout << "Promotions: " << counts.promotions << endl;
+    cout << "Checks: " << counts.checks << endl;
+    cout << "Checkmates: " << counts.checkmates << endl;
+  }
 
 GetNextNode:
   if (depth - 1 > 0) {
@@ -474,54 +725,6 @@ auto Game::GetFideMoveStr(const Move& move) -> string {
   return move_str;
 }
 
-auto Game::GetUciMoveStr(const Move& move) -> string {
-  string move_str;
-  // Denote the moving player for the move as the player that just finished
-  // their turn.
-  S8 moving_player = board_.GetPlayerToMove();
-  if (move.castling_type == kNA) {
-    move_str += static_cast<char>('a' + GetFileFromSq(move.start_sq));
-    move_str += static_cast<char>('1' + GetRankFromSq(move.start_sq));
-    move_str += static_cast<char>('a' + GetFileFromSq(move.target_sq));
-    move_str += static_cast<char>('1' + GetRankFromSq(move.target_sq));
-
-    if (move.promoted_to_piece != kNA) {
-      switch (move.promoted_to_piece) {
-        case kKnight:
-          move_str += 'k';
-          break;
-        case kBishop:
-          move_str += 'b';
-          break;
-        case kRook:
-          move_str += 'r';
-          break;
-        case kQueen:
-          move_str += 'q';
-          break;
-        default:
-          throw invalid_argument(
-              "move.promoted_to_piece in Game::GetUciMoveStr()");
-      }
-    }
-  } else if (move.castling_type == kQueenSide) {
-    if (moving_player == kWhite) {
-      move_str = "e1c1";
-    } else {
-      move_str = "e8c8";
-    }
-  } else if (move.castling_type == kKingSide) {
-    if (moving_player == kWhite) {
-      move_str = "e1g1";
-    } else {
-      move_str = "e8g8";
-    }
-  } else {
-    throw invalid_argument("move.castling_type in Game::GetUciMoveStr()");
-  }
-  return move_str;
-}
-
 auto Game::AddStartSqToMove(Move& move, S8 start_rank, S8 start_file,
                             S8 target_rank, S8 target_file,
                             bool capture_indicated) const -> void {
@@ -10,12 +10,13 @@
 #define OMEGAZERO_SRC_GAME_H_
 
 #include <iostream>
-#include <map>
 #include <string>
+#include <unordered_map>
 
 #include "board.h"
 #include "engine.h"
 #include "move.h"
+#include "opening_book.h"
 
 namespace omegazero {
 
@@ -31,12 +32,19 @@ auto GetPlayerStr(S8 player) -> string;
 
 auto GetPieceType(char piece_ch) -> S8;
 
+// Construct a string denoting a move made by the given player in UCI long
+// algebraic notation.
+auto GetUciMoveStr(const Move& move, S8 moving_player) -> string;
+
 class Game {
  public:
   Game(const string& init_pos, const string& opening_book_path,
-       char player_side, float search_time, bool on_opening = true);
+       char player_side, float search_time, bool on_opening = true,
+       const SearchOptions& search_options = SearchOptions());
 
   auto IsActive() const -> bool;
+  // Pick a move from the opening book for the current position. Return false
+  // once the game has left the book.
   auto GetOpeningMove(Move& opening_move) -> bool;
 
   auto MakeEngineMove() -> Move;
@@ -47,8 +55,17 @@ class Game {
   auto OutputWinner() const -> void;
   auto Play() -> void;
   auto Save(string game_record_file) -> void;
-  // Output the results of Perft in readable format.
-  auto Test(int depth) -> void;
+  // Convert a text file of opening lines written in FIDE algebraic notation
+  // (such as "p3ECO.txt"), or the games of a PGN file ending in ".pgn", into a
+  // binary opening book. Each move is weighted by the number of lines it
+  // appears in from its position.
+  auto BuildOpeningBook(const string& lines_path, const string& book_path)
+      -> void;
+  // Output the results of Perft in readable format, optionally followed by
+  // the number of leaves reached by each type of move and by hardware
+  // performance counters per leaf.
+  auto Test(int depth, bool show_breakdown = false,
+            bool count_perf_events = false) -> void;
 
  private:
   // Construct a Move struct from a user command.
@@ -56,8 +73,6 @@ class Game {
 
   // Construct a string denoting a move in FIDE standard algebraic notation.
   auto GetFideMoveStr(const Move& move) -> string;
-  // Construct a string denoting a move in UCI standard algebraic notation.
-  auto GetUciMoveStr(const Move& move) -> string;
 
   auto AddStartSqToMove(Move& move, S8 start_rank, S8 start_file,
                         S8 target_rank, S8 target_file,
@@ -77,28 +92,24 @@ class Game {
 
   bool game_active_;
   bool on_opening_;
+  // Print the board and moves made by the engine.
+  bool verbose_;
 
   Engine engine_;
 
   float search_time_;
 
   int turn_num_;
-  // Store the possible lines to choose from in the opening book.
-  vector<string> opening_book_;
+  OpeningBook opening_book_;
 
   S8 winner_;
 
   string move_history_;
   string piece_symbols_[kNumPlayers][kNumPieceTypes];
 
-  // Implement a custom hash function for unordered_map that calls the board's
-  // hash function.
-  struct BoardKeyHash {
-    size_t operator()(const Board& board) const {
-      return static_cast<size_t>(board.GetBoardHash());
-    }
-  };
-  unordered_map<Board, S8, BoardKeyHash> pos_history_;
+  // Count the number of times each position has occured, keyed by the board
+  // hash.
+  unordered_map<U64, S8> pos_history_;
 };
 
 // Implement inline non-member functions.
@@ -130,11 +141,7 @@ inline auto Game::OutputWinner() const -> void {
 }
 
 inline auto Game::RecordBoardState() -> void {
-  if (pos_history_.find(board_) == pos_history_.end()) {
-    pos_history_[board_] = 1;
-  } else {
-    ++pos_history_[board_];
-  }
+  ++pos_history_[board_.GetBoardHash()];
 }
 
 inline auto Game::RecordFinalScore() -> void {
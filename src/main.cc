@@ -5,14 +5,24 @@
  * Licensed under MIT License. Terms and conditions enclosed in "LICENSE.txt".
  */
 
+#include <algorithm>
 #include <boost/program_options.hpp>
 #include <cerrno>
 #include <iostream>
+#include <limits>
 #include <stdexcept>
 #include <string>
+#include <thread>
 
+#include "analysis.h"
+#include "bench.h"
+#include "eval_params.h"
 #include "game.h"
 #include "move.h"
+#include "nnue.h"
+#include "selfplay.h"
+#include "tablebase.h"
+#include "tuner.h"
 
 using std::cout;
 using std::endl;
@@ -20,19 +30,114 @@ using std::invalid_argument;
 using std::runtime_error;
 using std::string;
 using std::to_string;
+using std::vector;
+
+namespace {
+
+namespace prog_opt = boost::program_options;
+
+// Construct the search options for an engine from parsed command line
+// arguments.
+auto GetSearchOptions(const prog_opt::variables_map& var_map)
+    -> omegazero::SearchOptions {
+  omegazero::SearchOptions search_options;
+  string search_algorithm = var_map["search-algorithm"].as<string>();
+  if (search_algorithm == "mtdf") {
+    search_options.search_algorithm = omegazero::kMtdf;
+  } else if (search_algorithm == "pvs") {
+    search_options.search_algorithm = omegazero::kAspirationPvs;
+  } else {
+    throw invalid_argument("search algorithm must be \"mtdf\" or \"pvs\"");
+  }
+  if (var_map.count("stats")) {
+    if (!omegazero::kSearchStatsEnabled) {
+      throw invalid_argument(
+          "search statistics require a build made with \"make stats\"");
+    }
+    string stats_format = var_map["stats"].as<string>();
+    if (stats_format == "text") {
+      search_options.stats_format = omegazero::kTextStats;
+    } else if (stats_format == "json") {
+      search_options.stats_format = omegazero::kJsonStats;
+    } else {
+      throw invalid_argument("stats format must be \"text\" or \"json\"");
+    }
+  }
+
+  if (var_map.count("nodes")) {
+    search_options.node_limit = var_map["nodes"].as<unsigned long long>();
+  }
+  if (var_map.count("depth")) {
+    search_options.depth_limit = var_map["depth"].as<int>();
+  }
+  search_options.hash_size_mb = var_map["hash"].as<int>();
+  search_options.reverse_futility_pruning = !var_map.count("no-rfp");
+  search_options.futility_pruning = !var_map.count("no-futility");
+  search_options.razoring = !var_map.count("no-razoring");
+  search_options.late_move_pruning = !var_map.count("no-lmp");
+  search_options.reverse_futility_margin = var_map["rfp-margin"].as<int>();
+  search_options.futility_margin = var_map["futility-margin"].as<int>();
+  search_options.razoring_margin = var_map["razoring-margin"].as<int>();
+  return search_options;
+}
+
+// Load the evaluation weights given by "--eval-params", if any, into storage
+// that outlives the engines and point the search options at them.
+auto LoadEvalParamsOption(const prog_opt::variables_map& var_map,
+                          omegazero::EvalParams& eval_params,
+                          omegazero::SearchOptions& search_options) -> void {
+  if (var_map.count("eval-params")) {
+    eval_params =
+        omegazero::LoadEvalParams(var_map["eval-params"].as<string>());
+    search_options.eval_params = &eval_params;
+  }
+}
+
+// Load the NNUE network given by "--nnue", if any, into storage that outlives
+// the engines and point the search options at it.
+auto LoadNnueOption(const prog_opt::variables_map& var_map,
+                    omegazero::NnueNetwork& nnue_network,
+                    omegazero::SearchOptions& search_options) -> void {
+  if (var_map.count("nnue")) {
+    nnue_network.Load(var_map["nnue"].as<string>());
+    search_options.nnue_network = &nnue_network;
+  }
+}
+
+// Compute the search time of an engine that isn't playing a human user. Node
+// and depth limits alone decide when to stop searching, unless a search time is
+// also given.
+auto GetSearchTime(const prog_opt::variables_map& var_map) -> float {
+  if ((var_map.count("depth") || var_map.count("nodes")) &&
+      var_map["time"].defaulted()) {
+    return std::numeric_limits<float>::max();
+  }
+  return var_map["time"].as<float>();
+}
+
+}  // namespace
 
 auto main(int argc, char* argv[]) -> int {
-  // Compute the default path for the opening book.
+  // Compute the default paths for the opening book and the endgame
+  // tablebases.
   string opening_book_path(argv[0]);
   constexpr size_t kProgNameLen = 9;
   opening_book_path.erase(opening_book_path.length() - kProgNameLen);
-  opening_book_path += "../p3ECO.txt";
+  string tablebase_path = opening_book_path + "tablebases";
+  opening_book_path += "book.bin";
 
   // Parse optional arguments for testing and specifying initial position.
-  namespace prog_opt = boost::program_options;
   prog_opt::options_description desc("Options");
   string init_pos;
   string game_record_file;
+  string eco_path;
+  string epd_path;
+  string opponent_args;
+  int num_threads;
+  int num_tablebase_pieces;
+  int num_eval_bench_rounds;
+  omegazero::SelfplayOptions selfplay_options;
+  omegazero::TunerOptions tuner_options;
   float search_time;
   int depth;
   char player_side;
@@ -42,7 +147,15 @@ auto main(int argc, char* argv[]) -> int {
           "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1"),
       "FEN formatted string specifying the initial game position")(
       "depth,d", prog_opt::value<int>(&depth),
-      "Depth to run Perft testing function to")(
+      "Depth to run Perft testing function, the benchmark, EPD analysis, or "
+      "self-play searches to")(
+      "perf-counters",
+      "Read hardware performance counters, such as cycles and cache misses, "
+      "around Perft or the benchmark and output them per node (Linux "
+      "only)")(
+      "perft-breakdown",
+      "Also count the Perft leaves reached by captures, en passent, castles, "
+      "promotions, checks, and checkmates")(
       "player-side,p", prog_opt::value<char>(&player_side)->default_value('w'),
       "Side user will play")(
       "time,t", prog_opt::value<float>(&search_time)->default_value(5),
@@ -50,7 +163,83 @@ auto main(int argc, char* argv[]) -> int {
                      prog_opt::value<string>(&opening_book_path),
                      "Opening book file path")(
       "save,s", prog_opt::value<string>(&game_record_file),
-      "File to save the move history to after a game is finished.");
+      "File to save the move history to after a game is finished.")(
+      "search-algorithm,a", prog_opt::value<string>()->default_value("mtdf"),
+      "Root search algorithm, either \"mtdf\" or \"pvs\"")(
+      "bench,b",
+      "Run a fixed-depth search benchmark, searching to the depth given by "
+      "--depth")("bench-eval",
+                 prog_opt::value<int>(&num_eval_bench_rounds)
+                     ->implicit_value(omegazero::kDefaultEvalBenchRounds),
+                 "Time the evaluation over the benchmark positions for the "
+                 "given number of rounds, comparing it with the scalar "
+                 "evaluation")("stats", prog_opt::value<string>(),
+                 "Output search statistics after each search iteration as "
+                 "\"text\" or \"json\" (requires \"make stats\")")(
+      "make-book", prog_opt::value<string>(&eco_path),
+      "Convert a text file of opening lines, such as p3ECO.txt, or a PGN file "
+      "ending in .pgn into a binary opening book written to "
+      "--opening-book-path")(
+      "analyze-epd", prog_opt::value<string>(&epd_path),
+      "Search every position in an EPD file, writing the results as JSON "
+      "lines. Searches are limited by --depth, --nodes, or --time")(
+      "nodes,n", prog_opt::value<unsigned long long>(),
+      "Maximum number of nodes to search per move")(
+      "hash",
+      prog_opt::value<int>()->default_value(omegazero::kDefaultHashSizeMb),
+      "Size of each engine's transposition table in megabytes")(
+      "no-rfp", "Disable reverse futility (static null move) pruning")(
+      "no-futility", "Disable futility pruning of quiet moves")(
+      "no-razoring", "Disable razoring into the quiescence search")(
+      "no-lmp", "Disable late move pruning of quiet moves")(
+      "rfp-margin",
+      prog_opt::value<int>()->default_value(
+          omegazero::kDefaultReverseFutilityMargin),
+      "Reverse futility pruning margin per ply of remaining depth")(
+      "futility-margin",
+      prog_opt::value<int>()->default_value(omegazero::kDefaultFutilityMargin),
+      "Futility pruning margin per ply of remaining depth")(
+      "razoring-margin",
+      prog_opt::value<int>()->default_value(omegazero::kDefaultRazoringMargin),
+      "Razoring margin per ply of remaining depth")(
+      "threads,j",
+      prog_opt::value<int>(&num_threads)->default_value(
+          static_cast<int>(std::max(1U, std::thread::hardware_concurrency()))),
+      "Number of worker threads used for EPD analysis, self-play, and "
+      "tuning")(
+      "selfplay", prog_opt::value<int>(&selfplay_options.num_games),
+      "Play a match of the given number of games between the engine and "
+      "--opponent, starting from book openings")(
+      "opponent", prog_opt::value<string>(&opponent_args),
+      "Search options of the self-play opponent, such as \"-a pvs -n "
+      "20000\". Defaults to the engine's own options")(
+      "sprt-elo0",
+      prog_opt::value<double>(&selfplay_options.sprt_elo0)->default_value(0.0),
+      "Elo difference of the self-play SPRT null hypothesis")(
+      "sprt-elo1",
+      prog_opt::value<double>(&selfplay_options.sprt_elo1)->default_value(5.0),
+      "Elo difference of the self-play SPRT alternative hypothesis")(
+      "tablebase-path", prog_opt::value<string>(&tablebase_path),
+      "Directory of the endgame tablebases probed during searches")(
+      "make-tablebases", prog_opt::value<int>(&num_tablebase_pieces),
+      "Generate the endgame tablebases of every material combination with at "
+      "most the given number of pieces (3 or 4) into --tablebase-path")(
+      "tune", prog_opt::value<string>(&tuner_options.dataset_path),
+      "Tune the evaluation weights on a file of positions labelled with game "
+      "results, such as \"<FEN> [0.5]\"")(
+      "tune-output",
+      prog_opt::value<string>(&tuner_options.output_path)
+          ->default_value("tuned_params.txt"),
+      "File to write the tuned evaluation weights to")(
+      "tune-epochs",
+      prog_opt::value<int>(&tuner_options.num_epochs)->default_value(500),
+      "Number of gradient descent steps taken by the tuner")(
+      "eval-params", prog_opt::value<string>(),
+      "File of evaluation weights, such as one written by --tune, to use "
+      "instead of the built-in weights. Tuning starts from these weights")(
+      "nnue", prog_opt::value<string>(),
+      "NNUE network file to evaluate positions with instead of the "
+      "hand-crafted evaluation");
   prog_opt::variables_map var_map;
   try {
     prog_opt::store(prog_opt::parse_command_line(argc, argv, desc), var_map);
@@ -61,13 +250,106 @@ auto main(int argc, char* argv[]) -> int {
   }
 
   try {
+    omegazero::SearchOptions search_options = GetSearchOptions(var_map);
+    omegazero::EvalParams eval_params;
+    LoadEvalParamsOption(var_map, eval_params, search_options);
+    omegazero::NnueNetwork nnue_network;
+    LoadNnueOption(var_map, nnue_network, search_options);
+    omegazero::Tablebases tablebases;
+    if (var_map.count("make-tablebases")) {
+      tablebases.Generate(tablebase_path, num_tablebase_pieces);
+      return 0;
+    }
+    if (tablebases.Load(tablebase_path) > 0) {
+      search_options.tablebases = &tablebases;
+    }
+
+    if (var_map.count("analyze-epd")) {
+      omegazero::RunEpdAnalysis(epd_path, num_threads, GetSearchTime(var_map),
+                                search_options);
+      return 0;
+    }
+
+    if (var_map.count("tune")) {
+      tuner_options.num_threads = num_threads;
+      if (search_options.eval_params != nullptr) {
+        tuner_options.initial_params = eval_params;
+      }
+      omegazero::RunTexelTuning(tuner_options);
+      return 0;
+    }
+
+    if (var_map.count("selfplay")) {
+      // Play a match between two engines, parsing the opponent's search
+      // options with the same option descriptions as the engine's.
+      omegazero::EngineConfig engine_config{GetSearchTime(var_map),
+                                            search_options};
+      engine_config.search_options.verbose = false;
+      omegazero::EngineConfig opponent_config = engine_config;
+      omegazero::EvalParams opponent_eval_params;
+      omegazero::NnueNetwork opponent_nnue_network;
+      if (var_map.count("opponent")) {
+        vector<string> opponent_argv = prog_opt::split_unix(opponent_args);
+        prog_opt::variables_map opponent_var_map;
+        try {
+          prog_opt::store(prog_opt::command_line_parser(opponent_argv)
+                              .options(desc)
+                              .run(),
+                          opponent_var_map);
+        } catch (prog_opt::error& e) {
+          cout << "ERROR: Parsing fault in --opponent: " << e.what() << endl;
+          return EINVAL;
+        }
+        opponent_config.search_time = GetSearchTime(opponent_var_map);
+        opponent_config.search_options = GetSearchOptions(opponent_var_map);
+        opponent_config.search_options.verbose = false;
+        opponent_config.search_options.tablebases = search_options.tablebases;
+        LoadEvalParamsOption(opponent_var_map, opponent_eval_params,
+                             opponent_config.search_options);
+        LoadNnueOption(opponent_var_map, opponent_nnue_network,
+                       opponent_config.search_options);
+      }
+      selfplay_options.num_threads = num_threads;
+      selfplay_options.opening_book_path = opening_book_path;
+      omegazero::RunSelfplay(selfplay_options, engine_config, opponent_config);
+      return 0;
+    }
+
+    if (var_map.count("bench")) {
+      // Output the node count and speed of a fixed-depth search benchmark.
+      // Leave out the tablebases so that node counts don't depend on which
+      // tables are installed.
+      int bench_depth =
+          var_map.count("depth") ? depth : omegazero::kDefaultBenchDepth;
+      search_options.tablebases = nullptr;
+      omegazero::RunBench(bench_depth, search_options,
+                          var_map.count("perf-counters"));
+      return 0;
+    }
+
+    if (var_map.count("bench-eval")) {
+      omegazero::RunEvalBench(num_eval_bench_rounds);
+      return 0;
+    }
+
+    if (var_map.count("make-book")) {
+      // Build a binary opening book from lines played from the initial
+      // position.
+      constexpr bool kNoOpeningBook = false;
+      omegazero::Game game(init_pos, opening_book_path, player_side,
+                           search_time, kNoOpeningBook, search_options);
+      game.BuildOpeningBook(eco_path, opening_book_path);
+      return 0;
+    }
+
     bool on_opening =
         init_pos == "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
     omegazero::Game game(init_pos, opening_book_path, player_side, search_time,
-                         on_opening);
+                         on_opening, search_options);
     if (var_map.count("depth")) {
       // Output perft results.
-      game.Test(depth);
+      game.Test(depth, var_map.count("perft-breakdown"),
+                var_map.count("perf-counters"));
     } else {
       // Play a game against a user.
       while (game.IsActive()) {
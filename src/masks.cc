@@ -347,4 +347,2979 @@ const Bitboard kPawnFrontSpanMasks[kNumPlayers][kNumSq] = {
    0X00C0C0C0C0C0C0C0}
 };
 
+const Bitboard kQueenRayMasks[kNumSq] =
+  // Define queen ray masks.
+  {0X81412111090503FE, 0X02824222120A07FD, 0X0404844424150EFB,
+   0X08080888492A1CF7, 0X10101011925438EF, 0X2020212224A870DF,
+   0X404142444850E0BF, 0X8182848890A0C07F, 0X412111090503FE03,
+   0X824222120A07FD07, 0X04844424150EFB0E, 0X080888492A1CF71C,
+   0X101011925438EF38, 0X20212224A870DF70, 0X4142444850E0BFE0,
+   0X82848890A0C07FC0, 0X2111090503FE0305, 0X4222120A07FD070A,
+   0X844424150EFB0E15, 0X0888492A1CF71C2A, 0X1011925438EF3854,
+   0X212224A870DF70A8, 0X42444850E0BFE050, 0X848890A0C07FC0A0,
+   0X11090503FE030509, 0X22120A07FD070A12, 0X4424150EFB0E1524,
+   0X88492A1CF71C2A49, 0X11925438EF385492, 0X2224A870DF70A824,
+   0X444850E0BFE05048, 0X8890A0C07FC0A090, 0X090503FE03050911,
+   0X120A07FD070A1222, 0X24150EFB0E152444, 0X492A1CF71C2A4988,
+   0X925438EF38549211, 0X24A870DF70A82422, 0X4850E0BFE0504844,
+   0X90A0C07FC0A09088, 0X0503FE0305091121, 0X0A07FD070A122242,
+   0X150EFB0E15244484, 0X2A1CF71C2A498808, 0X5438EF3854921110,
+   0XA870DF70A8242221, 0X50E0BFE050484442, 0XA0C07FC0A0908884,
+   0X03FE030509112141, 0X07FD070A12224282, 0X0EFB0E1524448404,
+   0X1CF71C2A49880808, 0X38EF385492111010, 0X70DF70A824222120,
+   0XE0BFE05048444241, 0XC07FC0A090888482, 0XFE03050911214181,
+   0XFD070A1222428202, 0XFB0E152444840404, 0XF71C2A4988080808,
+   0XEF38549211101010, 0XDF70A82422212020, 0XBFE0504844424140,
+   0X7FC0A09088848281};
+
+const Bitboard kBetweenMasks[kNumSq][kNumSq] = {
+  // Define masks of squares between a1 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000000002,
+   0X0000000000000006, 0X000000000000000E, 0X000000000000001E,
+   0X000000000000003E, 0X000000000000007E, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000100, 0X0000000000000000,
+   0X0000000000000200, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000010100, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000040200, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000001010100,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000008040200, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000101010100, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000001008040200, 0X0000000000000000, 0X0000000000000000,
+   0X0000010101010100, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000201008040200, 0X0000000000000000, 0X0001010101010100,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0040201008040200},
+  // Define masks of squares between b1 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000004, 0X000000000000000C, 0X000000000000001C,
+   0X000000000000003C, 0X000000000000007C, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000200,
+   0X0000000000000000, 0X0000000000000400, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000020200, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000080400, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000002020200, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000010080400, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000202020200,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000002010080400, 0X0000000000000000,
+   0X0000000000000000, 0X0000020202020200, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000402010080400, 0X0000000000000000,
+   0X0002020202020200, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of squares between c1 and each square.
+  {0X0000000000000002, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000008, 0X0000000000000018,
+   0X0000000000000038, 0X0000000000000078, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000200, 0X0000000000000000,
+   0X0000000000000400, 0X0000000000000000, 0X0000000000000800,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000040400,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000100800,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000004040400, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000020100800,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000404040400, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000004020100800,
+   0X0000000000000000, 0X0000000000000000, 0X0000040404040400,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0004040404040400, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of squares between d1 and each square.
+  {0X0000000000000006, 0X0000000000000004, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000010,
+   0X0000000000000030, 0X0000000000000070, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000400,
+   0X0000000000000000, 0X0000000000000800, 0X0000000000000000,
+   0X0000000000001000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000020400, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000080800, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000201000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000008080800,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000040201000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000808080800, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000080808080800, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0008080808080800,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of squares between e1 and each square.
+  {0X000000000000000E, 0X000000000000000C, 0X0000000000000008,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000020, 0X0000000000000060, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000800, 0X0000000000000000, 0X0000000000001000,
+   0X0000000000000000, 0X0000000000002000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000040800, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000101000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000402000, 0X0000000002040800,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000010101000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000001010101000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000101010101000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0010101010101000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of squares between f1 and each square.
+  {0X000000000000001E, 0X000000000000001C, 0X0000000000000018,
+   0X0000000000000010, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000040, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000001000, 0X0000000000000000,
+   0X0000000000002000, 0X0000000000000000, 0X0000000000004000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000081000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000202000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000004081000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000020202000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000204081000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000002020202000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000202020202000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0020202020202000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of squares between g1 and each square.
+  {0X000000000000003E, 0X000000000000003C, 0X0000000000000038,
+   0X0000000000000030, 0X0000000000000020, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000002000,
+   0X0000000000000000, 0X0000000000004000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000102000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000404000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000008102000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000040404000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000408102000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000004040404000, 0X0000000000000000,
+   0X0000020408102000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000404040404000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0040404040404000,
+   0X0000000000000000},
+  // Define masks of squares between h1 and each square.
+  {0X000000000000007E, 0X000000000000007C, 0X0000000000000078,
+   0X0000000000000070, 0X0000000000000060, 0X0000000000000040,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000004000, 0X0000000000000000, 0X0000000000008000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000204000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000808000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000010204000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000080808000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000810204000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000008080808000,
+   0X0000000000000000, 0X0000040810204000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000808080808000, 0X0002040810204000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0080808080808000},
+  // Define masks of squares between a2 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000200, 0X0000000000000600,
+   0X0000000000000E00, 0X0000000000001E00, 0X0000000000003E00,
+   0X0000000000007E00, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000010000, 0X0000000000000000, 0X0000000000020000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000001010000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000004020000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000101010000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000804020000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000010101010000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000100804020000,
+   0X0000000000000000, 0X0000000000000000, 0X0001010101010000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0020100804020000,
+   0X0000000000000000},
+  // Define masks of squares between b2 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000400,
+   0X0000000000000C00, 0X0000000000001C00, 0X0000000000003C00,
+   0X0000000000007C00, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000020000, 0X0000000000000000,
+   0X0000000000040000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000002020000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000008040000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000202020000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000001008040000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000020202020000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000201008040000, 0X0000000000000000, 0X0000000000000000,
+   0X0002020202020000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0040201008040000},
+  // Define masks of squares between c2 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000200,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000800, 0X0000000000001800, 0X0000000000003800,
+   0X0000000000007800, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000020000, 0X0000000000000000, 0X0000000000040000,
+   0X0000000000000000, 0X0000000000080000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000004040000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000010080000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000404040000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000002010080000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000040404040000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000402010080000, 0X0000000000000000,
+   0X0000000000000000, 0X0004040404040000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of squares between d2 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000600,
+   0X0000000000000400, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000001000, 0X0000000000003000,
+   0X0000000000007000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000040000, 0X0000000000000000,
+   0X0000000000080000, 0X0000000000000000, 0X0000000000100000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000002040000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000008080000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000020100000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000808080000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000004020100000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000080808080000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0008080808080000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of squares between e2 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000E00,
+   0X0000000000000C00, 0X0000000000000800, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000002000,
+   0X0000000000006000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000080000,
+   0X0000000000000000, 0X0000000000100000, 0X0000000000000000,
+   0X0000000000200000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000004080000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000010100000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000040200000, 0X0000000204080000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000001010100000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000101010100000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0010101010100000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of squares between f2 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000001E00,
+   0X0000000000001C00, 0X0000000000001800, 0X0000000000001000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000004000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000100000, 0X0000000000000000, 0X0000000000200000,
+   0X0000000000000000, 0X0000000000400000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000008100000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000020200000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000408100000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000002020200000, 0X0000000000000000, 0X0000000000000000,
+   0X0000020408100000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000202020200000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0020202020200000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of squares between g2 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000003E00,
+   0X0000000000003C00, 0X0000000000003800, 0X0000000000003000,
+   0X0000000000002000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000200000, 0X0000000000000000,
+   0X0000000000400000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000010200000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000040400000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000810200000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000004040400000, 0X0000000000000000,
+   0X0000000000000000, 0X0000040810200000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000404040400000, 0X0000000000000000, 0X0002040810200000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0040404040400000,
+   0X0000000000000000},
+  // Define masks of squares between h2 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000007E00,
+   0X0000000000007C00, 0X0000000000007800, 0X0000000000007000,
+   0X0000000000006000, 0X0000000000004000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000400000,
+   0X0000000000000000, 0X0000000000800000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000020400000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000080800000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000001020400000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000008080800000,
+   0X0000000000000000, 0X0000000000000000, 0X0000081020400000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000808080800000, 0X0000000000000000,
+   0X0004081020400000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0080808080800000},
+  // Define masks of squares between a3 and each square.
+  {0X0000000000000100, 0X0000000000000000, 0X0000000000000200,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000020000, 0X0000000000060000, 0X00000000000E0000,
+   0X00000000001E0000, 0X00000000003E0000, 0X00000000007E0000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000001000000,
+   0X0000000000000000, 0X0000000002000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000101000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000402000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000010101000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000080402000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0001010101000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0010080402000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of squares between b3 and each square.
+  {0X0000000000000000, 0X0000000000000200, 0X0000000000000000,
+   0X0000000000000400, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000040000, 0X00000000000C0000,
+   0X00000000001C0000, 0X00000000003C0000, 0X00000000007C0000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000002000000, 0X0000000000000000, 0X0000000004000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000202000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000804000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000020202000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000100804000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0002020202000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0020100804000000,
+   0X0000000000000000},
+  // Define masks of squares between c3 and each square.
+  {0X0000000000000200, 0X0000000000000000, 0X0000000000000400,
+   0X0000000000000000, 0X0000000000000800, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000020000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000080000,
+   0X0000000000180000, 0X0000000000380000, 0X0000000000780000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000002000000,
+   0X0000000000000000, 0X0000000004000000, 0X0000000000000000,
+   0X0000000008000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000404000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000001008000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000040404000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000201008000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0004040404000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0040201008000000},
+  // Define masks of squares between d3 and each square.
+  {0X0000000000000000, 0X0000000000000400, 0X0000000000000000,
+   0X0000000000000800, 0X0000000000000000, 0X0000000000001000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000060000, 0X0000000000040000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000100000, 0X0000000000300000, 0X0000000000700000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000004000000, 0X0000000000000000, 0X0000000008000000,
+   0X0000000000000000, 0X0000000010000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000204000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000808000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000002010000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000080808000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000402010000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0008080808000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of squares between e3 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000000800,
+   0X0000000000000000, 0X0000000000001000, 0X0000000000000000,
+   0X0000000000002000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X00000000000E0000, 0X00000000000C0000,
+   0X0000000000080000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000200000, 0X0000000000600000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000008000000, 0X0000000000000000,
+   0X0000000010000000, 0X0000000000000000, 0X0000000020000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000408000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000001010000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000004020000000,
+   0X0000020408000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000101010000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0010101010000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of squares between f3 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000001000, 0X0000000000000000, 0X0000000000002000,
+   0X0000000000000000, 0X0000000000004000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X00000000001E0000, 0X00000000001C0000,
+   0X0000000000180000, 0X0000000000100000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000400000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000010000000,
+   0X0000000000000000, 0X0000000020000000, 0X0000000000000000,
+   0X0000000040000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000810000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000002020000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000040810000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000202020000000,
+   0X0000000000000000, 0X0000000000000000, 0X0002040810000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0020202020000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of squares between g3 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000002000, 0X0000000000000000,
+   0X0000000000004000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X00000000003E0000, 0X00000000003C0000,
+   0X0000000000380000, 0X0000000000300000, 0X0000000000200000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000020000000, 0X0000000000000000, 0X0000000040000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000001020000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000004040000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000081020000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000404040000000, 0X0000000000000000, 0X0000000000000000,
+   0X0004081020000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0040404040000000,
+   0X0000000000000000},
+  // Define masks of squares between h3 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000004000,
+   0X0000000000000000, 0X0000000000008000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X00000000007E0000, 0X00000000007C0000,
+   0X0000000000780000, 0X0000000000700000, 0X0000000000600000,
+   0X0000000000400000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000040000000, 0X0000000000000000,
+   0X0000000080000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000002040000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000008080000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000102040000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000808080000000, 0X0000000000000000,
+   0X0000000000000000, 0X0008102040000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0080808080000000},
+  // Define masks of squares between a4 and each square.
+  {0X0000000000010100, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000020400, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000010000,
+   0X0000000000000000, 0X0000000000020000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000002000000,
+   0X0000000006000000, 0X000000000E000000, 0X000000001E000000,
+   0X000000003E000000, 0X000000007E000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000100000000, 0X0000000000000000,
+   0X0000000200000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000010100000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000040200000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0001010100000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0008040200000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of squares between b4 and each square.
+  {0X0000000000000000, 0X0000000000020200, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000040800, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000020000, 0X0000000000000000, 0X0000000000040000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000004000000, 0X000000000C000000, 0X000000001C000000,
+   0X000000003C000000, 0X000000007C000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000200000000,
+   0X0000000000000000, 0X0000000400000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000020200000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000080400000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0002020200000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0010080400000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of squares between c4 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000040400,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000081000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000020000,
+   0X0000000000000000, 0X0000000000040000, 0X0000000000000000,
+   0X0000000000080000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000002000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000008000000, 0X0000000018000000,
+   0X0000000038000000, 0X0000000078000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000200000000, 0X0000000000000000,
+   0X0000000400000000, 0X0000000000000000, 0X0000000800000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000040400000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000100800000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0004040400000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0020100800000000,
+   0X0000000000000000},
+  // Define masks of squares between d4 and each square.
+  {0X0000000000040200, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000080800, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000102000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000040000, 0X0000000000000000, 0X0000000000080000,
+   0X0000000000000000, 0X0000000000100000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000006000000, 0X0000000004000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000010000000,
+   0X0000000030000000, 0X0000000070000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000400000000,
+   0X0000000000000000, 0X0000000800000000, 0X0000000000000000,
+   0X0000001000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000020400000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000080800000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000201000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0008080800000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0040201000000000},
+  // Define masks of squares between e4 and each square.
+  {0X0000000000000000, 0X0000000000080400, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000101000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000204000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000080000, 0X0000000000000000,
+   0X0000000000100000, 0X0000000000000000, 0X0000000000200000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X000000000E000000, 0X000000000C000000, 0X0000000008000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000020000000, 0X0000000060000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000800000000, 0X0000000000000000, 0X0000001000000000,
+   0X0000000000000000, 0X0000002000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000040800000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000101000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000402000000000, 0X0002040800000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0010101000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of squares between f4 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000100800,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000202000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000100000,
+   0X0000000000000000, 0X0000000000200000, 0X0000000000000000,
+   0X0000000000400000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X000000001E000000, 0X000000001C000000, 0X0000000018000000,
+   0X0000000010000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000040000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000001000000000, 0X0000000000000000,
+   0X0000002000000000, 0X0000000000000000, 0X0000004000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000081000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000202000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0004081000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0020202000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of squares between g4 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000201000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000404000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000200000, 0X0000000000000000, 0X0000000000400000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X000000003E000000, 0X000000003C000000, 0X0000000038000000,
+   0X0000000030000000, 0X0000000020000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000002000000000,
+   0X0000000000000000, 0X0000004000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000102000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000404000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0008102000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0040404000000000,
+   0X0000000000000000},
+  // Define masks of squares between h4 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000402000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000808000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000400000, 0X0000000000000000,
+   0X0000000000800000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X000000007E000000, 0X000000007C000000, 0X0000000078000000,
+   0X0000000070000000, 0X0000000060000000, 0X0000000040000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000004000000000, 0X0000000000000000, 0X0000008000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000204000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000808000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0010204000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0080808000000000},
+  // Define masks of squares between a5 and each square.
+  {0X0000000001010100, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000002040800, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000001010000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000002040000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000001000000, 0X0000000000000000,
+   0X0000000002000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000200000000, 0X0000000600000000,
+   0X0000000E00000000, 0X0000001E00000000, 0X0000003E00000000,
+   0X0000007E00000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000010000000000, 0X0000000000000000, 0X0000020000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0001010000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0004020000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of squares between b5 and each square.
+  {0X0000000000000000, 0X0000000002020200, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000004081000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000002020000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000004080000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000002000000,
+   0X0000000000000000, 0X0000000004000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000400000000,
+   0X0000000C00000000, 0X0000001C00000000, 0X0000003C00000000,
+   0X0000007C00000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000020000000000, 0X0000000000000000,
+   0X0000040000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0002020000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0008040000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of squares between c5 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000004040400,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000008102000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000004040000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000008100000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000002000000, 0X0000000000000000,
+   0X0000000004000000, 0X0000000000000000, 0X0000000008000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000200000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000800000000, 0X0000001800000000, 0X0000003800000000,
+   0X0000007800000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000020000000000, 0X0000000000000000, 0X0000040000000000,
+   0X0000000000000000, 0X0000080000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0004040000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0010080000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of squares between d5 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000008080800, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000010204000, 0X0000000004020000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000008080000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000010200000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000004000000,
+   0X0000000000000000, 0X0000000008000000, 0X0000000000000000,
+   0X0000000010000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000600000000,
+   0X0000000400000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000001000000000, 0X0000003000000000,
+   0X0000007000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000040000000000, 0X0000000000000000,
+   0X0000080000000000, 0X0000000000000000, 0X0000100000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0002040000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0008080000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0020100000000000,
+   0X0000000000000000},
+  // Define masks of squares between e5 and each square.
+  {0X0000000008040200, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000010101000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000008040000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000010100000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000020400000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000008000000, 0X0000000000000000, 0X0000000010000000,
+   0X0000000000000000, 0X0000000020000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000E00000000,
+   0X0000000C00000000, 0X0000000800000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000002000000000,
+   0X0000006000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000080000000000,
+   0X0000000000000000, 0X0000100000000000, 0X0000000000000000,
+   0X0000200000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0004080000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0010100000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0040200000000000},
+  // Define masks of squares between f5 and each square.
+  {0X0000000000000000, 0X0000000010080400, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000020202000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000010080000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000020200000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000010000000, 0X0000000000000000,
+   0X0000000020000000, 0X0000000000000000, 0X0000000040000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000001E00000000,
+   0X0000001C00000000, 0X0000001800000000, 0X0000001000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000004000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000100000000000, 0X0000000000000000, 0X0000200000000000,
+   0X0000000000000000, 0X0000400000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0008100000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0020200000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of squares between g5 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000020100800,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000040404000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000020100000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000040400000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000020000000,
+   0X0000000000000000, 0X0000000040000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000003E00000000,
+   0X0000003C00000000, 0X0000003800000000, 0X0000003000000000,
+   0X0000002000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000200000000000, 0X0000000000000000,
+   0X0000400000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0010200000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0040400000000000,
+   0X0000000000000000},
+  // Define masks of squares between h5 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000040201000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000080808000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000040200000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000080800000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000040000000, 0X0000000000000000, 0X0000000080000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000007E00000000,
+   0X0000007C00000000, 0X0000007800000000, 0X0000007000000000,
+   0X0000006000000000, 0X0000004000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000400000000000,
+   0X0000000000000000, 0X0000800000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0020400000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0080800000000000},
+  // Define masks of squares between a6 and each square.
+  {0X0000000101010100, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000204081000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000101010000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000204080000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000101000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000204000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000100000000, 0X0000000000000000, 0X0000000200000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000020000000000, 0X0000060000000000, 0X00000E0000000000,
+   0X00001E0000000000, 0X00003E0000000000, 0X00007E0000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0001000000000000,
+   0X0000000000000000, 0X0002000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of squares between b6 and each square.
+  {0X0000000000000000, 0X0000000202020200, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000408102000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000202020000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000408100000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000202000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000408000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000200000000, 0X0000000000000000,
+   0X0000000400000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000040000000000, 0X00000C0000000000,
+   0X00001C0000000000, 0X00003C0000000000, 0X00007C0000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0002000000000000, 0X0000000000000000, 0X0004000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of squares between c6 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000404040400,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000810204000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000404040000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000810200000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000404000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000810000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000200000000, 0X0000000000000000, 0X0000000400000000,
+   0X0000000000000000, 0X0000000800000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000020000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000080000000000,
+   0X0000180000000000, 0X0000380000000000, 0X0000780000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0002000000000000,
+   0X0000000000000000, 0X0004000000000000, 0X0000000000000000,
+   0X0008000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of squares between d6 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000808080800, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000808080000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000001020400000, 0X0000000402000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000808000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000001020000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000400000000, 0X0000000000000000,
+   0X0000000800000000, 0X0000000000000000, 0X0000001000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000060000000000, 0X0000040000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000100000000000, 0X0000300000000000, 0X0000700000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0004000000000000, 0X0000000000000000, 0X0008000000000000,
+   0X0000000000000000, 0X0010000000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of squares between e6 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000001010101000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000804020000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000001010100000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000804000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000001010000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000002040000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000800000000,
+   0X0000000000000000, 0X0000001000000000, 0X0000000000000000,
+   0X0000002000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X00000E0000000000, 0X00000C0000000000,
+   0X0000080000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000200000000000, 0X0000600000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0008000000000000, 0X0000000000000000,
+   0X0010000000000000, 0X0000000000000000, 0X0020000000000000,
+   0X0000000000000000},
+  // Define masks of squares between f6 and each square.
+  {0X0000001008040200, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000002020202000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000001008040000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000002020200000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000001008000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000002020000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000001000000000, 0X0000000000000000, 0X0000002000000000,
+   0X0000000000000000, 0X0000004000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X00001E0000000000, 0X00001C0000000000,
+   0X0000180000000000, 0X0000100000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000400000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0010000000000000,
+   0X0000000000000000, 0X0020000000000000, 0X0000000000000000,
+   0X0040000000000000},
+  // Define masks of squares between g6 and each square.
+  {0X0000000000000000, 0X0000002010080400, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000004040404000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000002010080000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000004040400000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000002010000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000004040000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000002000000000, 0X0000000000000000,
+   0X0000004000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X00003E0000000000, 0X00003C0000000000,
+   0X0000380000000000, 0X0000300000000000, 0X0000200000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0020000000000000, 0X0000000000000000, 0X0040000000000000,
+   0X0000000000000000},
+  // Define masks of squares between h6 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000004020100800,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000008080808000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000004020100000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000008080800000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000004020000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000008080000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000004000000000,
+   0X0000000000000000, 0X0000008000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X00007E0000000000, 0X00007C0000000000,
+   0X0000780000000000, 0X0000700000000000, 0X0000600000000000,
+   0X0000400000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0040000000000000, 0X0000000000000000,
+   0X0080000000000000},
+  // Define masks of squares between a7 and each square.
+  {0X0000010101010100, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000020408102000, 0X0000000000000000, 0X0000010101010000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000020408100000, 0X0000000000000000,
+   0X0000000000000000, 0X0000010101000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000020408000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000010100000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000020400000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000010000000000,
+   0X0000000000000000, 0X0000020000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0002000000000000,
+   0X0006000000000000, 0X000E000000000000, 0X001E000000000000,
+   0X003E000000000000, 0X007E000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of squares between b7 and each square.
+  {0X0000000000000000, 0X0000020202020200, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000040810204000, 0X0000000000000000,
+   0X0000020202020000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000040810200000,
+   0X0000000000000000, 0X0000000000000000, 0X0000020202000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000040810000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000020200000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000040800000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000020000000000, 0X0000000000000000, 0X0000040000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0004000000000000, 0X000C000000000000, 0X001C000000000000,
+   0X003C000000000000, 0X007C000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of squares between c7 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000040404040400,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000040404040000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000081020400000, 0X0000000000000000, 0X0000000000000000,
+   0X0000040404000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000081020000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000040400000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000081000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000020000000000,
+   0X0000000000000000, 0X0000040000000000, 0X0000000000000000,
+   0X0000080000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0002000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0008000000000000, 0X0018000000000000,
+   0X0038000000000000, 0X0078000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of squares between d7 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000080808080800, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000080808080000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000080808000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000102040000000,
+   0X0000040200000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000080800000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000102000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000040000000000, 0X0000000000000000, 0X0000080000000000,
+   0X0000000000000000, 0X0000100000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0006000000000000, 0X0004000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0010000000000000,
+   0X0030000000000000, 0X0070000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of squares between e7 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000101010101000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000101010100000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000080402000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000101010000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000080400000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000101000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000204000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000080000000000, 0X0000000000000000,
+   0X0000100000000000, 0X0000000000000000, 0X0000200000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X000E000000000000, 0X000C000000000000, 0X0008000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0020000000000000, 0X0060000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of squares between f7 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000202020202000,
+   0X0000000000000000, 0X0000000000000000, 0X0000100804020000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000202020200000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000100804000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000202020000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000100800000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000202000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000100000000000,
+   0X0000000000000000, 0X0000200000000000, 0X0000000000000000,
+   0X0000400000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X001E000000000000, 0X001C000000000000, 0X0018000000000000,
+   0X0010000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0040000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of squares between g7 and each square.
+  {0X0000201008040200, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000404040404000, 0X0000000000000000, 0X0000000000000000,
+   0X0000201008040000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000404040400000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000201008000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000404040000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000201000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000404000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000200000000000, 0X0000000000000000, 0X0000400000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X003E000000000000, 0X003C000000000000, 0X0038000000000000,
+   0X0030000000000000, 0X0020000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of squares between h7 and each square.
+  {0X0000000000000000, 0X0000402010080400, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000808080808000, 0X0000000000000000,
+   0X0000000000000000, 0X0000402010080000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000808080800000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000402010000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000808080000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000402000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000808000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000400000000000, 0X0000000000000000,
+   0X0000800000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X007E000000000000, 0X007C000000000000, 0X0078000000000000,
+   0X0070000000000000, 0X0060000000000000, 0X0040000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of squares between a8 and each square.
+  {0X0001010101010100, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0002040810204000, 0X0001010101010000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0002040810200000,
+   0X0000000000000000, 0X0001010101000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0002040810000000, 0X0000000000000000, 0X0000000000000000,
+   0X0001010100000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0002040800000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0001010000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0002040000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0001000000000000, 0X0000000000000000,
+   0X0002000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0200000000000000, 0X0600000000000000,
+   0X0E00000000000000, 0X1E00000000000000, 0X3E00000000000000,
+   0X7E00000000000000},
+  // Define masks of squares between b8 and each square.
+  {0X0000000000000000, 0X0002020202020200, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0002020202020000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0004081020400000, 0X0000000000000000, 0X0002020202000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0004081020000000, 0X0000000000000000,
+   0X0000000000000000, 0X0002020200000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0004081000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0002020000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0004080000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0002000000000000,
+   0X0000000000000000, 0X0004000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0400000000000000,
+   0X0C00000000000000, 0X1C00000000000000, 0X3C00000000000000,
+   0X7C00000000000000},
+  // Define masks of squares between c8 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0004040404040400,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0004040404040000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0004040404000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0008102040000000,
+   0X0000000000000000, 0X0000000000000000, 0X0004040400000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0008102000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0004040000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0008100000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0002000000000000, 0X0000000000000000,
+   0X0004000000000000, 0X0000000000000000, 0X0008000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0200000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0800000000000000, 0X1800000000000000, 0X3800000000000000,
+   0X7800000000000000},
+  // Define masks of squares between d8 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0008080808080800, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0008080808080000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0008080808000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0008080800000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0010204000000000, 0X0004020000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0008080000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0010200000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0004000000000000,
+   0X0000000000000000, 0X0008000000000000, 0X0000000000000000,
+   0X0010000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0600000000000000,
+   0X0400000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X1000000000000000, 0X3000000000000000,
+   0X7000000000000000},
+  // Define masks of squares between e8 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0010101010101000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0010101010100000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0010101010000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0008040200000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0010101000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0008040000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0010100000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0020400000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0008000000000000, 0X0000000000000000, 0X0010000000000000,
+   0X0000000000000000, 0X0020000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0E00000000000000,
+   0X0C00000000000000, 0X0800000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X2000000000000000,
+   0X6000000000000000},
+  // Define masks of squares between f8 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0020202020202000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0020202020200000, 0X0000000000000000,
+   0X0000000000000000, 0X0010080402000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0020202020000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0010080400000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0020202000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0010080000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0020200000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0010000000000000, 0X0000000000000000,
+   0X0020000000000000, 0X0000000000000000, 0X0040000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X1E00000000000000,
+   0X1C00000000000000, 0X1800000000000000, 0X1000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X4000000000000000},
+  // Define masks of squares between g8 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0040404040404000, 0X0000000000000000, 0X0020100804020000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0040404040400000,
+   0X0000000000000000, 0X0000000000000000, 0X0020100804000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0040404040000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0020100800000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0040404000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0020100000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0040400000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0020000000000000,
+   0X0000000000000000, 0X0040000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X3E00000000000000,
+   0X3C00000000000000, 0X3800000000000000, 0X3000000000000000,
+   0X2000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of squares between h8 and each square.
+  {0X0040201008040200, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0080808080808000, 0X0000000000000000,
+   0X0040201008040000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0080808080800000, 0X0000000000000000, 0X0000000000000000,
+   0X0040201008000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0080808080000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0040201000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0080808000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0040200000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0080800000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0040000000000000, 0X0000000000000000, 0X0080000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X7E00000000000000,
+   0X7C00000000000000, 0X7800000000000000, 0X7000000000000000,
+   0X6000000000000000, 0X4000000000000000, 0X0000000000000000,
+   0X0000000000000000}
+};
+
+const Bitboard kLineMasks[kNumSq][kNumSq] = {
+  // Define masks of lines through a1 and each square.
+  {0X0000000000000000, 0X00000000000000FF, 0X00000000000000FF,
+   0X00000000000000FF, 0X00000000000000FF, 0X00000000000000FF,
+   0X00000000000000FF, 0X00000000000000FF, 0X0101010101010101,
+   0X8040201008040201, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0101010101010101, 0X0000000000000000,
+   0X8040201008040201, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0101010101010101, 0X0000000000000000, 0X0000000000000000,
+   0X8040201008040201, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0101010101010101,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X8040201008040201, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0101010101010101, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X8040201008040201, 0X0000000000000000, 0X0000000000000000,
+   0X0101010101010101, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X8040201008040201, 0X0000000000000000, 0X0101010101010101,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X8040201008040201},
+  // Define masks of lines through b1 and each square.
+  {0X00000000000000FF, 0X0000000000000000, 0X00000000000000FF,
+   0X00000000000000FF, 0X00000000000000FF, 0X00000000000000FF,
+   0X00000000000000FF, 0X00000000000000FF, 0X0000000000000102,
+   0X0202020202020202, 0X0080402010080402, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0202020202020202,
+   0X0000000000000000, 0X0080402010080402, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0202020202020202, 0X0000000000000000,
+   0X0000000000000000, 0X0080402010080402, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0202020202020202, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0080402010080402, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0202020202020202,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0080402010080402, 0X0000000000000000,
+   0X0000000000000000, 0X0202020202020202, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0080402010080402, 0X0000000000000000,
+   0X0202020202020202, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of lines through c1 and each square.
+  {0X00000000000000FF, 0X00000000000000FF, 0X0000000000000000,
+   0X00000000000000FF, 0X00000000000000FF, 0X00000000000000FF,
+   0X00000000000000FF, 0X00000000000000FF, 0X0000000000000000,
+   0X0000000000010204, 0X0404040404040404, 0X0000804020100804,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000010204, 0X0000000000000000,
+   0X0404040404040404, 0X0000000000000000, 0X0000804020100804,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0404040404040404,
+   0X0000000000000000, 0X0000000000000000, 0X0000804020100804,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0404040404040404, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000804020100804,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0404040404040404, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000804020100804,
+   0X0000000000000000, 0X0000000000000000, 0X0404040404040404,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0404040404040404, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of lines through d1 and each square.
+  {0X00000000000000FF, 0X00000000000000FF, 0X00000000000000FF,
+   0X0000000000000000, 0X00000000000000FF, 0X00000000000000FF,
+   0X00000000000000FF, 0X00000000000000FF, 0X0000000000000000,
+   0X0000000000000000, 0X0000000001020408, 0X0808080808080808,
+   0X0000008040201008, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000001020408,
+   0X0000000000000000, 0X0808080808080808, 0X0000000000000000,
+   0X0000008040201008, 0X0000000000000000, 0X0000000000000000,
+   0X0000000001020408, 0X0000000000000000, 0X0000000000000000,
+   0X0808080808080808, 0X0000000000000000, 0X0000000000000000,
+   0X0000008040201008, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0808080808080808,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000008040201008, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0808080808080808, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0808080808080808, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0808080808080808,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of lines through e1 and each square.
+  {0X00000000000000FF, 0X00000000000000FF, 0X00000000000000FF,
+   0X00000000000000FF, 0X0000000000000000, 0X00000000000000FF,
+   0X00000000000000FF, 0X00000000000000FF, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000102040810,
+   0X1010101010101010, 0X0000000080402010, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000102040810, 0X0000000000000000, 0X1010101010101010,
+   0X0000000000000000, 0X0000000080402010, 0X0000000000000000,
+   0X0000000000000000, 0X0000000102040810, 0X0000000000000000,
+   0X0000000000000000, 0X1010101010101010, 0X0000000000000000,
+   0X0000000000000000, 0X0000000080402010, 0X0000000102040810,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X1010101010101010, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X1010101010101010,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X1010101010101010, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X1010101010101010, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of lines through f1 and each square.
+  {0X00000000000000FF, 0X00000000000000FF, 0X00000000000000FF,
+   0X00000000000000FF, 0X00000000000000FF, 0X0000000000000000,
+   0X00000000000000FF, 0X00000000000000FF, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000010204081020, 0X2020202020202020, 0X0000000000804020,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000010204081020, 0X0000000000000000,
+   0X2020202020202020, 0X0000000000000000, 0X0000000000804020,
+   0X0000000000000000, 0X0000000000000000, 0X0000010204081020,
+   0X0000000000000000, 0X0000000000000000, 0X2020202020202020,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000010204081020, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X2020202020202020, 0X0000000000000000,
+   0X0000000000000000, 0X0000010204081020, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X2020202020202020, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X2020202020202020,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X2020202020202020, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of lines through g1 and each square.
+  {0X00000000000000FF, 0X00000000000000FF, 0X00000000000000FF,
+   0X00000000000000FF, 0X00000000000000FF, 0X00000000000000FF,
+   0X0000000000000000, 0X00000000000000FF, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0001020408102040, 0X4040404040404040,
+   0X0000000000008040, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0001020408102040,
+   0X0000000000000000, 0X4040404040404040, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0001020408102040, 0X0000000000000000, 0X0000000000000000,
+   0X4040404040404040, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0001020408102040, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X4040404040404040,
+   0X0000000000000000, 0X0000000000000000, 0X0001020408102040,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X4040404040404040, 0X0000000000000000,
+   0X0001020408102040, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X4040404040404040, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X4040404040404040,
+   0X0000000000000000},
+  // Define masks of lines through h1 and each square.
+  {0X00000000000000FF, 0X00000000000000FF, 0X00000000000000FF,
+   0X00000000000000FF, 0X00000000000000FF, 0X00000000000000FF,
+   0X00000000000000FF, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0102040810204080,
+   0X8080808080808080, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0102040810204080, 0X0000000000000000, 0X8080808080808080,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0102040810204080, 0X0000000000000000,
+   0X0000000000000000, 0X8080808080808080, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0102040810204080,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X8080808080808080, 0X0000000000000000, 0X0000000000000000,
+   0X0102040810204080, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X8080808080808080,
+   0X0000000000000000, 0X0102040810204080, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X8080808080808080, 0X0102040810204080,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X8080808080808080},
+  // Define masks of lines through a2 and each square.
+  {0X0101010101010101, 0X0000000000000102, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X000000000000FF00, 0X000000000000FF00, 0X000000000000FF00,
+   0X000000000000FF00, 0X000000000000FF00, 0X000000000000FF00,
+   0X000000000000FF00, 0X0101010101010101, 0X4020100804020100,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0101010101010101, 0X0000000000000000, 0X4020100804020100,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0101010101010101,
+   0X0000000000000000, 0X0000000000000000, 0X4020100804020100,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0101010101010101, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X4020100804020100,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0101010101010101, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X4020100804020100,
+   0X0000000000000000, 0X0000000000000000, 0X0101010101010101,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X4020100804020100,
+   0X0000000000000000},
+  // Define masks of lines through b2 and each square.
+  {0X8040201008040201, 0X0202020202020202, 0X0000000000010204,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X000000000000FF00,
+   0X0000000000000000, 0X000000000000FF00, 0X000000000000FF00,
+   0X000000000000FF00, 0X000000000000FF00, 0X000000000000FF00,
+   0X000000000000FF00, 0X0000000000010204, 0X0202020202020202,
+   0X8040201008040201, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0202020202020202, 0X0000000000000000,
+   0X8040201008040201, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0202020202020202, 0X0000000000000000, 0X0000000000000000,
+   0X8040201008040201, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0202020202020202,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X8040201008040201, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0202020202020202, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X8040201008040201, 0X0000000000000000, 0X0000000000000000,
+   0X0202020202020202, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X8040201008040201},
+  // Define masks of lines through c2 and each square.
+  {0X0000000000000000, 0X0080402010080402, 0X0404040404040404,
+   0X0000000001020408, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X000000000000FF00,
+   0X000000000000FF00, 0X0000000000000000, 0X000000000000FF00,
+   0X000000000000FF00, 0X000000000000FF00, 0X000000000000FF00,
+   0X000000000000FF00, 0X0000000000000000, 0X0000000001020408,
+   0X0404040404040404, 0X0080402010080402, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000001020408, 0X0000000000000000, 0X0404040404040404,
+   0X0000000000000000, 0X0080402010080402, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0404040404040404, 0X0000000000000000,
+   0X0000000000000000, 0X0080402010080402, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0404040404040404, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0080402010080402, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0404040404040404,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0080402010080402, 0X0000000000000000,
+   0X0000000000000000, 0X0404040404040404, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of lines through d2 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000804020100804,
+   0X0808080808080808, 0X0000000102040810, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X000000000000FF00,
+   0X000000000000FF00, 0X000000000000FF00, 0X0000000000000000,
+   0X000000000000FF00, 0X000000000000FF00, 0X000000000000FF00,
+   0X000000000000FF00, 0X0000000000000000, 0X0000000000000000,
+   0X0000000102040810, 0X0808080808080808, 0X0000804020100804,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000102040810, 0X0000000000000000,
+   0X0808080808080808, 0X0000000000000000, 0X0000804020100804,
+   0X0000000000000000, 0X0000000000000000, 0X0000000102040810,
+   0X0000000000000000, 0X0000000000000000, 0X0808080808080808,
+   0X0000000000000000, 0X0000000000000000, 0X0000804020100804,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0808080808080808, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000804020100804,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0808080808080808, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0808080808080808,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of lines through e2 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000008040201008, 0X1010101010101010, 0X0000010204081020,
+   0X0000000000000000, 0X0000000000000000, 0X000000000000FF00,
+   0X000000000000FF00, 0X000000000000FF00, 0X000000000000FF00,
+   0X0000000000000000, 0X000000000000FF00, 0X000000000000FF00,
+   0X000000000000FF00, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000010204081020, 0X1010101010101010,
+   0X0000008040201008, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000010204081020,
+   0X0000000000000000, 0X1010101010101010, 0X0000000000000000,
+   0X0000008040201008, 0X0000000000000000, 0X0000000000000000,
+   0X0000010204081020, 0X0000000000000000, 0X0000000000000000,
+   0X1010101010101010, 0X0000000000000000, 0X0000000000000000,
+   0X0000008040201008, 0X0000010204081020, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X1010101010101010,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X1010101010101010, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X1010101010101010, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of lines through f2 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000080402010, 0X2020202020202020,
+   0X0001020408102040, 0X0000000000000000, 0X000000000000FF00,
+   0X000000000000FF00, 0X000000000000FF00, 0X000000000000FF00,
+   0X000000000000FF00, 0X0000000000000000, 0X000000000000FF00,
+   0X000000000000FF00, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0001020408102040,
+   0X2020202020202020, 0X0000000080402010, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0001020408102040, 0X0000000000000000, 0X2020202020202020,
+   0X0000000000000000, 0X0000000080402010, 0X0000000000000000,
+   0X0000000000000000, 0X0001020408102040, 0X0000000000000000,
+   0X0000000000000000, 0X2020202020202020, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0001020408102040,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X2020202020202020, 0X0000000000000000, 0X0000000000000000,
+   0X0001020408102040, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X2020202020202020,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X2020202020202020, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of lines through g2 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000804020,
+   0X4040404040404040, 0X0102040810204080, 0X000000000000FF00,
+   0X000000000000FF00, 0X000000000000FF00, 0X000000000000FF00,
+   0X000000000000FF00, 0X000000000000FF00, 0X0000000000000000,
+   0X000000000000FF00, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0102040810204080, 0X4040404040404040, 0X0000000000804020,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0102040810204080, 0X0000000000000000,
+   0X4040404040404040, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0102040810204080,
+   0X0000000000000000, 0X0000000000000000, 0X4040404040404040,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0102040810204080, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X4040404040404040, 0X0000000000000000,
+   0X0000000000000000, 0X0102040810204080, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X4040404040404040, 0X0000000000000000, 0X0102040810204080,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X4040404040404040,
+   0X0000000000000000},
+  // Define masks of lines through h2 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000008040, 0X8080808080808080, 0X000000000000FF00,
+   0X000000000000FF00, 0X000000000000FF00, 0X000000000000FF00,
+   0X000000000000FF00, 0X000000000000FF00, 0X000000000000FF00,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0204081020408000, 0X8080808080808080,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0204081020408000,
+   0X0000000000000000, 0X8080808080808080, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0204081020408000, 0X0000000000000000, 0X0000000000000000,
+   0X8080808080808080, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0204081020408000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X8080808080808080,
+   0X0000000000000000, 0X0000000000000000, 0X0204081020408000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X8080808080808080, 0X0000000000000000,
+   0X0204081020408000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X8080808080808080},
+  // Define masks of lines through a3 and each square.
+  {0X0101010101010101, 0X0000000000000000, 0X0000000000010204,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0101010101010101,
+   0X0000000000010204, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000FF0000,
+   0X0000000000FF0000, 0X0000000000FF0000, 0X0000000000FF0000,
+   0X0000000000FF0000, 0X0000000000FF0000, 0X0000000000FF0000,
+   0X0101010101010101, 0X2010080402010000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0101010101010101,
+   0X0000000000000000, 0X2010080402010000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0101010101010101, 0X0000000000000000,
+   0X0000000000000000, 0X2010080402010000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0101010101010101, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X2010080402010000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0101010101010101,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X2010080402010000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of lines through b3 and each square.
+  {0X0000000000000000, 0X0202020202020202, 0X0000000000000000,
+   0X0000000001020408, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X4020100804020100,
+   0X0202020202020202, 0X0000000001020408, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000FF0000, 0X0000000000000000,
+   0X0000000000FF0000, 0X0000000000FF0000, 0X0000000000FF0000,
+   0X0000000000FF0000, 0X0000000000FF0000, 0X0000000000FF0000,
+   0X0000000001020408, 0X0202020202020202, 0X4020100804020100,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0202020202020202, 0X0000000000000000, 0X4020100804020100,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0202020202020202,
+   0X0000000000000000, 0X0000000000000000, 0X4020100804020100,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0202020202020202, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X4020100804020100,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0202020202020202, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X4020100804020100,
+   0X0000000000000000},
+  // Define masks of lines through c3 and each square.
+  {0X8040201008040201, 0X0000000000000000, 0X0404040404040404,
+   0X0000000000000000, 0X0000000102040810, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X8040201008040201, 0X0404040404040404, 0X0000000102040810,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000FF0000, 0X0000000000FF0000,
+   0X0000000000000000, 0X0000000000FF0000, 0X0000000000FF0000,
+   0X0000000000FF0000, 0X0000000000FF0000, 0X0000000000FF0000,
+   0X0000000000000000, 0X0000000102040810, 0X0404040404040404,
+   0X8040201008040201, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000102040810,
+   0X0000000000000000, 0X0404040404040404, 0X0000000000000000,
+   0X8040201008040201, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0404040404040404, 0X0000000000000000, 0X0000000000000000,
+   0X8040201008040201, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0404040404040404,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X8040201008040201, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0404040404040404, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X8040201008040201},
+  // Define masks of lines through d3 and each square.
+  {0X0000000000000000, 0X0080402010080402, 0X0000000000000000,
+   0X0808080808080808, 0X0000000000000000, 0X0000010204081020,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0080402010080402, 0X0808080808080808,
+   0X0000010204081020, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000FF0000, 0X0000000000FF0000,
+   0X0000000000FF0000, 0X0000000000000000, 0X0000000000FF0000,
+   0X0000000000FF0000, 0X0000000000FF0000, 0X0000000000FF0000,
+   0X0000000000000000, 0X0000000000000000, 0X0000010204081020,
+   0X0808080808080808, 0X0080402010080402, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000010204081020, 0X0000000000000000, 0X0808080808080808,
+   0X0000000000000000, 0X0080402010080402, 0X0000000000000000,
+   0X0000000000000000, 0X0000010204081020, 0X0000000000000000,
+   0X0000000000000000, 0X0808080808080808, 0X0000000000000000,
+   0X0000000000000000, 0X0080402010080402, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0808080808080808, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0080402010080402, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0808080808080808,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of lines through e3 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000804020100804,
+   0X0000000000000000, 0X1010101010101010, 0X0000000000000000,
+   0X0001020408102040, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000804020100804,
+   0X1010101010101010, 0X0001020408102040, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000FF0000, 0X0000000000FF0000,
+   0X0000000000FF0000, 0X0000000000FF0000, 0X0000000000000000,
+   0X0000000000FF0000, 0X0000000000FF0000, 0X0000000000FF0000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0001020408102040, 0X1010101010101010, 0X0000804020100804,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0001020408102040, 0X0000000000000000,
+   0X1010101010101010, 0X0000000000000000, 0X0000804020100804,
+   0X0000000000000000, 0X0000000000000000, 0X0001020408102040,
+   0X0000000000000000, 0X0000000000000000, 0X1010101010101010,
+   0X0000000000000000, 0X0000000000000000, 0X0000804020100804,
+   0X0001020408102040, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X1010101010101010, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X1010101010101010, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of lines through f3 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000008040201008, 0X0000000000000000, 0X2020202020202020,
+   0X0000000000000000, 0X0102040810204080, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000008040201008, 0X2020202020202020, 0X0102040810204080,
+   0X0000000000000000, 0X0000000000FF0000, 0X0000000000FF0000,
+   0X0000000000FF0000, 0X0000000000FF0000, 0X0000000000FF0000,
+   0X0000000000000000, 0X0000000000FF0000, 0X0000000000FF0000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0102040810204080, 0X2020202020202020,
+   0X0000008040201008, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0102040810204080,
+   0X0000000000000000, 0X2020202020202020, 0X0000000000000000,
+   0X0000008040201008, 0X0000000000000000, 0X0000000000000000,
+   0X0102040810204080, 0X0000000000000000, 0X0000000000000000,
+   0X2020202020202020, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0102040810204080, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X2020202020202020,
+   0X0000000000000000, 0X0000000000000000, 0X0102040810204080,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X2020202020202020, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of lines through g3 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000080402010, 0X0000000000000000,
+   0X4040404040404040, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000080402010, 0X4040404040404040,
+   0X0204081020408000, 0X0000000000FF0000, 0X0000000000FF0000,
+   0X0000000000FF0000, 0X0000000000FF0000, 0X0000000000FF0000,
+   0X0000000000FF0000, 0X0000000000000000, 0X0000000000FF0000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0204081020408000,
+   0X4040404040404040, 0X0000000080402010, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0204081020408000, 0X0000000000000000, 0X4040404040404040,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0204081020408000, 0X0000000000000000,
+   0X0000000000000000, 0X4040404040404040, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0204081020408000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X4040404040404040, 0X0000000000000000, 0X0000000000000000,
+   0X0204081020408000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X4040404040404040,
+   0X0000000000000000},
+  // Define masks of lines through h3 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000804020,
+   0X0000000000000000, 0X8080808080808080, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000804020,
+   0X8080808080808080, 0X0000000000FF0000, 0X0000000000FF0000,
+   0X0000000000FF0000, 0X0000000000FF0000, 0X0000000000FF0000,
+   0X0000000000FF0000, 0X0000000000FF0000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0408102040800000, 0X8080808080808080, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0408102040800000, 0X0000000000000000,
+   0X8080808080808080, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0408102040800000,
+   0X0000000000000000, 0X0000000000000000, 0X8080808080808080,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0408102040800000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X8080808080808080, 0X0000000000000000,
+   0X0000000000000000, 0X0408102040800000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X8080808080808080},
+  // Define masks of lines through a4 and each square.
+  {0X0101010101010101, 0X0000000000000000, 0X0000000000000000,
+   0X0000000001020408, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0101010101010101,
+   0X0000000000000000, 0X0000000001020408, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0101010101010101, 0X0000000001020408,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X00000000FF000000, 0X00000000FF000000,
+   0X00000000FF000000, 0X00000000FF000000, 0X00000000FF000000,
+   0X00000000FF000000, 0X00000000FF000000, 0X0101010101010101,
+   0X1008040201000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0101010101010101, 0X0000000000000000,
+   0X1008040201000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0101010101010101, 0X0000000000000000, 0X0000000000000000,
+   0X1008040201000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0101010101010101,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X1008040201000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of lines through b4 and each square.
+  {0X0000000000000000, 0X0202020202020202, 0X0000000000000000,
+   0X0000000000000000, 0X0000000102040810, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0202020202020202, 0X0000000000000000, 0X0000000102040810,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X2010080402010000, 0X0202020202020202,
+   0X0000000102040810, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X00000000FF000000, 0X0000000000000000, 0X00000000FF000000,
+   0X00000000FF000000, 0X00000000FF000000, 0X00000000FF000000,
+   0X00000000FF000000, 0X00000000FF000000, 0X0000000102040810,
+   0X0202020202020202, 0X2010080402010000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0202020202020202,
+   0X0000000000000000, 0X2010080402010000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0202020202020202, 0X0000000000000000,
+   0X0000000000000000, 0X2010080402010000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0202020202020202, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X2010080402010000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of lines through c4 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0404040404040404,
+   0X0000000000000000, 0X0000000000000000, 0X0000010204081020,
+   0X0000000000000000, 0X0000000000000000, 0X4020100804020100,
+   0X0000000000000000, 0X0404040404040404, 0X0000000000000000,
+   0X0000010204081020, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X4020100804020100,
+   0X0404040404040404, 0X0000010204081020, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X00000000FF000000, 0X00000000FF000000, 0X0000000000000000,
+   0X00000000FF000000, 0X00000000FF000000, 0X00000000FF000000,
+   0X00000000FF000000, 0X00000000FF000000, 0X0000000000000000,
+   0X0000010204081020, 0X0404040404040404, 0X4020100804020100,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000010204081020, 0X0000000000000000,
+   0X0404040404040404, 0X0000000000000000, 0X4020100804020100,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0404040404040404,
+   0X0000000000000000, 0X0000000000000000, 0X4020100804020100,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0404040404040404, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X4020100804020100,
+   0X0000000000000000},
+  // Define masks of lines through d4 and each square.
+  {0X8040201008040201, 0X0000000000000000, 0X0000000000000000,
+   0X0808080808080808, 0X0000000000000000, 0X0000000000000000,
+   0X0001020408102040, 0X0000000000000000, 0X0000000000000000,
+   0X8040201008040201, 0X0000000000000000, 0X0808080808080808,
+   0X0000000000000000, 0X0001020408102040, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X8040201008040201, 0X0808080808080808, 0X0001020408102040,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X00000000FF000000, 0X00000000FF000000, 0X00000000FF000000,
+   0X0000000000000000, 0X00000000FF000000, 0X00000000FF000000,
+   0X00000000FF000000, 0X00000000FF000000, 0X0000000000000000,
+   0X0000000000000000, 0X0001020408102040, 0X0808080808080808,
+   0X8040201008040201, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0001020408102040,
+   0X0000000000000000, 0X0808080808080808, 0X0000000000000000,
+   0X8040201008040201, 0X0000000000000000, 0X0000000000000000,
+   0X0001020408102040, 0X0000000000000000, 0X0000000000000000,
+   0X0808080808080808, 0X0000000000000000, 0X0000000000000000,
+   0X8040201008040201, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0808080808080808,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X8040201008040201},
+  // Define masks of lines through e4 and each square.
+  {0X0000000000000000, 0X0080402010080402, 0X0000000000000000,
+   0X0000000000000000, 0X1010101010101010, 0X0000000000000000,
+   0X0000000000000000, 0X0102040810204080, 0X0000000000000000,
+   0X0000000000000000, 0X0080402010080402, 0X0000000000000000,
+   0X1010101010101010, 0X0000000000000000, 0X0102040810204080,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0080402010080402, 0X1010101010101010,
+   0X0102040810204080, 0X0000000000000000, 0X0000000000000000,
+   0X00000000FF000000, 0X00000000FF000000, 0X00000000FF000000,
+   0X00000000FF000000, 0X0000000000000000, 0X00000000FF000000,
+   0X00000000FF000000, 0X00000000FF000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0102040810204080,
+   0X1010101010101010, 0X0080402010080402, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0102040810204080, 0X0000000000000000, 0X1010101010101010,
+   0X0000000000000000, 0X0080402010080402, 0X0000000000000000,
+   0X0000000000000000, 0X0102040810204080, 0X0000000000000000,
+   0X0000000000000000, 0X1010101010101010, 0X0000000000000000,
+   0X0000000000000000, 0X0080402010080402, 0X0102040810204080,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X1010101010101010, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of lines through f4 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000804020100804,
+   0X0000000000000000, 0X0000000000000000, 0X2020202020202020,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000804020100804,
+   0X0000000000000000, 0X2020202020202020, 0X0000000000000000,
+   0X0204081020408000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000804020100804,
+   0X2020202020202020, 0X0204081020408000, 0X0000000000000000,
+   0X00000000FF000000, 0X00000000FF000000, 0X00000000FF000000,
+   0X00000000FF000000, 0X00000000FF000000, 0X0000000000000000,
+   0X00000000FF000000, 0X00000000FF000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0204081020408000, 0X2020202020202020, 0X0000804020100804,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0204081020408000, 0X0000000000000000,
+   0X2020202020202020, 0X0000000000000000, 0X0000804020100804,
+   0X0000000000000000, 0X0000000000000000, 0X0204081020408000,
+   0X0000000000000000, 0X0000000000000000, 0X2020202020202020,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0204081020408000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X2020202020202020, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of lines through g4 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000008040201008, 0X0000000000000000, 0X0000000000000000,
+   0X4040404040404040, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000008040201008, 0X0000000000000000, 0X4040404040404040,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000008040201008, 0X4040404040404040, 0X0408102040800000,
+   0X00000000FF000000, 0X00000000FF000000, 0X00000000FF000000,
+   0X00000000FF000000, 0X00000000FF000000, 0X00000000FF000000,
+   0X0000000000000000, 0X00000000FF000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0408102040800000, 0X4040404040404040,
+   0X0000008040201008, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0408102040800000,
+   0X0000000000000000, 0X4040404040404040, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0408102040800000, 0X0000000000000000, 0X0000000000000000,
+   0X4040404040404040, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0408102040800000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X4040404040404040,
+   0X0000000000000000},
+  // Define masks of lines through h4 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000080402010, 0X0000000000000000,
+   0X0000000000000000, 0X8080808080808080, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000080402010, 0X0000000000000000,
+   0X8080808080808080, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000080402010, 0X8080808080808080,
+   0X00000000FF000000, 0X00000000FF000000, 0X00000000FF000000,
+   0X00000000FF000000, 0X00000000FF000000, 0X00000000FF000000,
+   0X00000000FF000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0810204080000000,
+   0X8080808080808080, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0810204080000000, 0X0000000000000000, 0X8080808080808080,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0810204080000000, 0X0000000000000000,
+   0X0000000000000000, 0X8080808080808080, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0810204080000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X8080808080808080},
+  // Define masks of lines through a5 and each square.
+  {0X0101010101010101, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000102040810, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0101010101010101,
+   0X0000000000000000, 0X0000000000000000, 0X0000000102040810,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0101010101010101, 0X0000000000000000,
+   0X0000000102040810, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0101010101010101, 0X0000000102040810, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X000000FF00000000, 0X000000FF00000000, 0X000000FF00000000,
+   0X000000FF00000000, 0X000000FF00000000, 0X000000FF00000000,
+   0X000000FF00000000, 0X0101010101010101, 0X0804020100000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0101010101010101, 0X0000000000000000, 0X0804020100000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0101010101010101,
+   0X0000000000000000, 0X0000000000000000, 0X0804020100000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of lines through b5 and each square.
+  {0X0000000000000000, 0X0202020202020202, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000010204081020,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0202020202020202, 0X0000000000000000, 0X0000000000000000,
+   0X0000010204081020, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0202020202020202,
+   0X0000000000000000, 0X0000010204081020, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X1008040201000000, 0X0202020202020202, 0X0000010204081020,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X000000FF00000000,
+   0X0000000000000000, 0X000000FF00000000, 0X000000FF00000000,
+   0X000000FF00000000, 0X000000FF00000000, 0X000000FF00000000,
+   0X000000FF00000000, 0X0000010204081020, 0X0202020202020202,
+   0X1008040201000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0202020202020202, 0X0000000000000000,
+   0X1008040201000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0202020202020202, 0X0000000000000000, 0X0000000000000000,
+   0X1008040201000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of lines through c5 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0404040404040404,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0001020408102040, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0404040404040404, 0X0000000000000000,
+   0X0000000000000000, 0X0001020408102040, 0X0000000000000000,
+   0X0000000000000000, 0X2010080402010000, 0X0000000000000000,
+   0X0404040404040404, 0X0000000000000000, 0X0001020408102040,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X2010080402010000, 0X0404040404040404,
+   0X0001020408102040, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X000000FF00000000,
+   0X000000FF00000000, 0X0000000000000000, 0X000000FF00000000,
+   0X000000FF00000000, 0X000000FF00000000, 0X000000FF00000000,
+   0X000000FF00000000, 0X0000000000000000, 0X0001020408102040,
+   0X0404040404040404, 0X2010080402010000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0001020408102040, 0X0000000000000000, 0X0404040404040404,
+   0X0000000000000000, 0X2010080402010000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0404040404040404, 0X0000000000000000,
+   0X0000000000000000, 0X2010080402010000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of lines through d5 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0808080808080808, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0102040810204080, 0X4020100804020100,
+   0X0000000000000000, 0X0000000000000000, 0X0808080808080808,
+   0X0000000000000000, 0X0000000000000000, 0X0102040810204080,
+   0X0000000000000000, 0X0000000000000000, 0X4020100804020100,
+   0X0000000000000000, 0X0808080808080808, 0X0000000000000000,
+   0X0102040810204080, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X4020100804020100,
+   0X0808080808080808, 0X0102040810204080, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X000000FF00000000,
+   0X000000FF00000000, 0X000000FF00000000, 0X0000000000000000,
+   0X000000FF00000000, 0X000000FF00000000, 0X000000FF00000000,
+   0X000000FF00000000, 0X0000000000000000, 0X0000000000000000,
+   0X0102040810204080, 0X0808080808080808, 0X4020100804020100,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0102040810204080, 0X0000000000000000,
+   0X0808080808080808, 0X0000000000000000, 0X4020100804020100,
+   0X0000000000000000, 0X0000000000000000, 0X0102040810204080,
+   0X0000000000000000, 0X0000000000000000, 0X0808080808080808,
+   0X0000000000000000, 0X0000000000000000, 0X4020100804020100,
+   0X0000000000000000},
+  // Define masks of lines through e5 and each square.
+  {0X8040201008040201, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X1010101010101010, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X8040201008040201, 0X0000000000000000, 0X0000000000000000,
+   0X1010101010101010, 0X0000000000000000, 0X0000000000000000,
+   0X0204081020408000, 0X0000000000000000, 0X0000000000000000,
+   0X8040201008040201, 0X0000000000000000, 0X1010101010101010,
+   0X0000000000000000, 0X0204081020408000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X8040201008040201, 0X1010101010101010, 0X0204081020408000,
+   0X0000000000000000, 0X0000000000000000, 0X000000FF00000000,
+   0X000000FF00000000, 0X000000FF00000000, 0X000000FF00000000,
+   0X0000000000000000, 0X000000FF00000000, 0X000000FF00000000,
+   0X000000FF00000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0204081020408000, 0X1010101010101010,
+   0X8040201008040201, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0204081020408000,
+   0X0000000000000000, 0X1010101010101010, 0X0000000000000000,
+   0X8040201008040201, 0X0000000000000000, 0X0000000000000000,
+   0X0204081020408000, 0X0000000000000000, 0X0000000000000000,
+   0X1010101010101010, 0X0000000000000000, 0X0000000000000000,
+   0X8040201008040201},
+  // Define masks of lines through f5 and each square.
+  {0X0000000000000000, 0X0080402010080402, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X2020202020202020,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0080402010080402, 0X0000000000000000,
+   0X0000000000000000, 0X2020202020202020, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0080402010080402, 0X0000000000000000,
+   0X2020202020202020, 0X0000000000000000, 0X0408102040800000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0080402010080402, 0X2020202020202020,
+   0X0408102040800000, 0X0000000000000000, 0X000000FF00000000,
+   0X000000FF00000000, 0X000000FF00000000, 0X000000FF00000000,
+   0X000000FF00000000, 0X0000000000000000, 0X000000FF00000000,
+   0X000000FF00000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0408102040800000,
+   0X2020202020202020, 0X0080402010080402, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0408102040800000, 0X0000000000000000, 0X2020202020202020,
+   0X0000000000000000, 0X0080402010080402, 0X0000000000000000,
+   0X0000000000000000, 0X0408102040800000, 0X0000000000000000,
+   0X0000000000000000, 0X2020202020202020, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of lines through g5 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000804020100804,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X4040404040404040, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000804020100804,
+   0X0000000000000000, 0X0000000000000000, 0X4040404040404040,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000804020100804,
+   0X0000000000000000, 0X4040404040404040, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000804020100804,
+   0X4040404040404040, 0X0810204080000000, 0X000000FF00000000,
+   0X000000FF00000000, 0X000000FF00000000, 0X000000FF00000000,
+   0X000000FF00000000, 0X000000FF00000000, 0X0000000000000000,
+   0X000000FF00000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0810204080000000, 0X4040404040404040, 0X0000804020100804,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0810204080000000, 0X0000000000000000,
+   0X4040404040404040, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0810204080000000,
+   0X0000000000000000, 0X0000000000000000, 0X4040404040404040,
+   0X0000000000000000},
+  // Define masks of lines through h5 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000008040201008, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X8080808080808080, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000008040201008, 0X0000000000000000, 0X0000000000000000,
+   0X8080808080808080, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000008040201008, 0X0000000000000000, 0X8080808080808080,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000008040201008, 0X8080808080808080, 0X000000FF00000000,
+   0X000000FF00000000, 0X000000FF00000000, 0X000000FF00000000,
+   0X000000FF00000000, 0X000000FF00000000, 0X000000FF00000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X1020408000000000, 0X8080808080808080,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X1020408000000000,
+   0X0000000000000000, 0X8080808080808080, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X1020408000000000, 0X0000000000000000, 0X0000000000000000,
+   0X8080808080808080},
+  // Define masks of lines through a6 and each square.
+  {0X0101010101010101, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000010204081020,
+   0X0000000000000000, 0X0000000000000000, 0X0101010101010101,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000010204081020, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0101010101010101, 0X0000000000000000,
+   0X0000000000000000, 0X0000010204081020, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0101010101010101, 0X0000000000000000, 0X0000010204081020,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0101010101010101,
+   0X0000010204081020, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000FF0000000000,
+   0X0000FF0000000000, 0X0000FF0000000000, 0X0000FF0000000000,
+   0X0000FF0000000000, 0X0000FF0000000000, 0X0000FF0000000000,
+   0X0101010101010101, 0X0402010000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0101010101010101,
+   0X0000000000000000, 0X0402010000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of lines through b6 and each square.
+  {0X0000000000000000, 0X0202020202020202, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0001020408102040, 0X0000000000000000, 0X0000000000000000,
+   0X0202020202020202, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0001020408102040, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0202020202020202,
+   0X0000000000000000, 0X0000000000000000, 0X0001020408102040,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0202020202020202, 0X0000000000000000,
+   0X0001020408102040, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0804020100000000,
+   0X0202020202020202, 0X0001020408102040, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000FF0000000000, 0X0000000000000000,
+   0X0000FF0000000000, 0X0000FF0000000000, 0X0000FF0000000000,
+   0X0000FF0000000000, 0X0000FF0000000000, 0X0000FF0000000000,
+   0X0001020408102040, 0X0202020202020202, 0X0804020100000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0202020202020202, 0X0000000000000000, 0X0804020100000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of lines through c6 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0404040404040404,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0102040810204080, 0X0000000000000000,
+   0X0000000000000000, 0X0404040404040404, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0102040810204080,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0404040404040404, 0X0000000000000000, 0X0000000000000000,
+   0X0102040810204080, 0X0000000000000000, 0X0000000000000000,
+   0X1008040201000000, 0X0000000000000000, 0X0404040404040404,
+   0X0000000000000000, 0X0102040810204080, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X1008040201000000, 0X0404040404040404, 0X0102040810204080,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000FF0000000000, 0X0000FF0000000000,
+   0X0000000000000000, 0X0000FF0000000000, 0X0000FF0000000000,
+   0X0000FF0000000000, 0X0000FF0000000000, 0X0000FF0000000000,
+   0X0000000000000000, 0X0102040810204080, 0X0404040404040404,
+   0X1008040201000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0102040810204080,
+   0X0000000000000000, 0X0404040404040404, 0X0000000000000000,
+   0X1008040201000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of lines through d6 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0808080808080808, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0808080808080808,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0204081020408000, 0X2010080402010000, 0X0000000000000000,
+   0X0000000000000000, 0X0808080808080808, 0X0000000000000000,
+   0X0000000000000000, 0X0204081020408000, 0X0000000000000000,
+   0X0000000000000000, 0X2010080402010000, 0X0000000000000000,
+   0X0808080808080808, 0X0000000000000000, 0X0204081020408000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X2010080402010000, 0X0808080808080808,
+   0X0204081020408000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000FF0000000000, 0X0000FF0000000000,
+   0X0000FF0000000000, 0X0000000000000000, 0X0000FF0000000000,
+   0X0000FF0000000000, 0X0000FF0000000000, 0X0000FF0000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0204081020408000,
+   0X0808080808080808, 0X2010080402010000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0204081020408000, 0X0000000000000000, 0X0808080808080808,
+   0X0000000000000000, 0X2010080402010000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of lines through e6 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X1010101010101010, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X4020100804020100,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X1010101010101010, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X4020100804020100,
+   0X0000000000000000, 0X0000000000000000, 0X1010101010101010,
+   0X0000000000000000, 0X0000000000000000, 0X0408102040800000,
+   0X0000000000000000, 0X0000000000000000, 0X4020100804020100,
+   0X0000000000000000, 0X1010101010101010, 0X0000000000000000,
+   0X0408102040800000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X4020100804020100,
+   0X1010101010101010, 0X0408102040800000, 0X0000000000000000,
+   0X0000000000000000, 0X0000FF0000000000, 0X0000FF0000000000,
+   0X0000FF0000000000, 0X0000FF0000000000, 0X0000000000000000,
+   0X0000FF0000000000, 0X0000FF0000000000, 0X0000FF0000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0408102040800000, 0X1010101010101010, 0X4020100804020100,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0408102040800000, 0X0000000000000000,
+   0X1010101010101010, 0X0000000000000000, 0X4020100804020100,
+   0X0000000000000000},
+  // Define masks of lines through f6 and each square.
+  {0X8040201008040201, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X2020202020202020,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X8040201008040201, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X2020202020202020, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X8040201008040201, 0X0000000000000000, 0X0000000000000000,
+   0X2020202020202020, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X8040201008040201, 0X0000000000000000, 0X2020202020202020,
+   0X0000000000000000, 0X0810204080000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X8040201008040201, 0X2020202020202020, 0X0810204080000000,
+   0X0000000000000000, 0X0000FF0000000000, 0X0000FF0000000000,
+   0X0000FF0000000000, 0X0000FF0000000000, 0X0000FF0000000000,
+   0X0000000000000000, 0X0000FF0000000000, 0X0000FF0000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0810204080000000, 0X2020202020202020,
+   0X8040201008040201, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0810204080000000,
+   0X0000000000000000, 0X2020202020202020, 0X0000000000000000,
+   0X8040201008040201},
+  // Define masks of lines through g6 and each square.
+  {0X0000000000000000, 0X0080402010080402, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X4040404040404040, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0080402010080402, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X4040404040404040,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0080402010080402, 0X0000000000000000,
+   0X0000000000000000, 0X4040404040404040, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0080402010080402, 0X0000000000000000,
+   0X4040404040404040, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0080402010080402, 0X4040404040404040,
+   0X1020408000000000, 0X0000FF0000000000, 0X0000FF0000000000,
+   0X0000FF0000000000, 0X0000FF0000000000, 0X0000FF0000000000,
+   0X0000FF0000000000, 0X0000000000000000, 0X0000FF0000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X1020408000000000,
+   0X4040404040404040, 0X0080402010080402, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X1020408000000000, 0X0000000000000000, 0X4040404040404040,
+   0X0000000000000000},
+  // Define masks of lines through h6 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000804020100804,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X8080808080808080, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000804020100804,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X8080808080808080, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000804020100804,
+   0X0000000000000000, 0X0000000000000000, 0X8080808080808080,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000804020100804,
+   0X0000000000000000, 0X8080808080808080, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000804020100804,
+   0X8080808080808080, 0X0000FF0000000000, 0X0000FF0000000000,
+   0X0000FF0000000000, 0X0000FF0000000000, 0X0000FF0000000000,
+   0X0000FF0000000000, 0X0000FF0000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X2040800000000000, 0X8080808080808080, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X2040800000000000, 0X0000000000000000,
+   0X8080808080808080},
+  // Define masks of lines through a7 and each square.
+  {0X0101010101010101, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0001020408102040, 0X0000000000000000, 0X0101010101010101,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0001020408102040, 0X0000000000000000,
+   0X0000000000000000, 0X0101010101010101, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0001020408102040,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0101010101010101, 0X0000000000000000, 0X0000000000000000,
+   0X0001020408102040, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0101010101010101,
+   0X0000000000000000, 0X0001020408102040, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0101010101010101, 0X0001020408102040,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X00FF000000000000, 0X00FF000000000000,
+   0X00FF000000000000, 0X00FF000000000000, 0X00FF000000000000,
+   0X00FF000000000000, 0X00FF000000000000, 0X0101010101010101,
+   0X0201000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of lines through b7 and each square.
+  {0X0000000000000000, 0X0202020202020202, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0102040810204080, 0X0000000000000000,
+   0X0202020202020202, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0102040810204080,
+   0X0000000000000000, 0X0000000000000000, 0X0202020202020202,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0102040810204080, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0202020202020202, 0X0000000000000000,
+   0X0000000000000000, 0X0102040810204080, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0202020202020202, 0X0000000000000000, 0X0102040810204080,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0402010000000000, 0X0202020202020202,
+   0X0102040810204080, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X00FF000000000000, 0X0000000000000000, 0X00FF000000000000,
+   0X00FF000000000000, 0X00FF000000000000, 0X00FF000000000000,
+   0X00FF000000000000, 0X00FF000000000000, 0X0102040810204080,
+   0X0202020202020202, 0X0402010000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of lines through c7 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0404040404040404,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0404040404040404, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0204081020408000, 0X0000000000000000, 0X0000000000000000,
+   0X0404040404040404, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0204081020408000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0404040404040404,
+   0X0000000000000000, 0X0000000000000000, 0X0204081020408000,
+   0X0000000000000000, 0X0000000000000000, 0X0804020100000000,
+   0X0000000000000000, 0X0404040404040404, 0X0000000000000000,
+   0X0204081020408000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0804020100000000,
+   0X0404040404040404, 0X0204081020408000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X00FF000000000000, 0X00FF000000000000, 0X0000000000000000,
+   0X00FF000000000000, 0X00FF000000000000, 0X00FF000000000000,
+   0X00FF000000000000, 0X00FF000000000000, 0X0000000000000000,
+   0X0204081020408000, 0X0404040404040404, 0X0804020100000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of lines through d7 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0808080808080808, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0808080808080808,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0808080808080808, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0408102040800000,
+   0X1008040201000000, 0X0000000000000000, 0X0000000000000000,
+   0X0808080808080808, 0X0000000000000000, 0X0000000000000000,
+   0X0408102040800000, 0X0000000000000000, 0X0000000000000000,
+   0X1008040201000000, 0X0000000000000000, 0X0808080808080808,
+   0X0000000000000000, 0X0408102040800000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X1008040201000000, 0X0808080808080808, 0X0408102040800000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X00FF000000000000, 0X00FF000000000000, 0X00FF000000000000,
+   0X0000000000000000, 0X00FF000000000000, 0X00FF000000000000,
+   0X00FF000000000000, 0X00FF000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0408102040800000, 0X0808080808080808,
+   0X1008040201000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of lines through e7 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X1010101010101010, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X1010101010101010, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X2010080402010000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X1010101010101010,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X2010080402010000, 0X0000000000000000,
+   0X0000000000000000, 0X1010101010101010, 0X0000000000000000,
+   0X0000000000000000, 0X0810204080000000, 0X0000000000000000,
+   0X0000000000000000, 0X2010080402010000, 0X0000000000000000,
+   0X1010101010101010, 0X0000000000000000, 0X0810204080000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X2010080402010000, 0X1010101010101010,
+   0X0810204080000000, 0X0000000000000000, 0X0000000000000000,
+   0X00FF000000000000, 0X00FF000000000000, 0X00FF000000000000,
+   0X00FF000000000000, 0X0000000000000000, 0X00FF000000000000,
+   0X00FF000000000000, 0X00FF000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0810204080000000,
+   0X1010101010101010, 0X2010080402010000, 0X0000000000000000,
+   0X0000000000000000},
+  // Define masks of lines through f7 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X2020202020202020,
+   0X0000000000000000, 0X0000000000000000, 0X4020100804020100,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X2020202020202020, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X4020100804020100,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X2020202020202020, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X4020100804020100,
+   0X0000000000000000, 0X0000000000000000, 0X2020202020202020,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X4020100804020100,
+   0X0000000000000000, 0X2020202020202020, 0X0000000000000000,
+   0X1020408000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X4020100804020100,
+   0X2020202020202020, 0X1020408000000000, 0X0000000000000000,
+   0X00FF000000000000, 0X00FF000000000000, 0X00FF000000000000,
+   0X00FF000000000000, 0X00FF000000000000, 0X0000000000000000,
+   0X00FF000000000000, 0X00FF000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X1020408000000000, 0X2020202020202020, 0X4020100804020100,
+   0X0000000000000000},
+  // Define masks of lines through g7 and each square.
+  {0X8040201008040201, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X4040404040404040, 0X0000000000000000, 0X0000000000000000,
+   0X8040201008040201, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X4040404040404040,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X8040201008040201, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X4040404040404040, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X8040201008040201, 0X0000000000000000, 0X0000000000000000,
+   0X4040404040404040, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X8040201008040201, 0X0000000000000000, 0X4040404040404040,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X8040201008040201, 0X4040404040404040, 0X2040800000000000,
+   0X00FF000000000000, 0X00FF000000000000, 0X00FF000000000000,
+   0X00FF000000000000, 0X00FF000000000000, 0X00FF000000000000,
+   0X0000000000000000, 0X00FF000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X2040800000000000, 0X4040404040404040,
+   0X8040201008040201},
+  // Define masks of lines through h7 and each square.
+  {0X0000000000000000, 0X0080402010080402, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X8080808080808080, 0X0000000000000000,
+   0X0000000000000000, 0X0080402010080402, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X8080808080808080, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0080402010080402, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X8080808080808080,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0080402010080402, 0X0000000000000000,
+   0X0000000000000000, 0X8080808080808080, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0080402010080402, 0X0000000000000000,
+   0X8080808080808080, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0080402010080402, 0X8080808080808080,
+   0X00FF000000000000, 0X00FF000000000000, 0X00FF000000000000,
+   0X00FF000000000000, 0X00FF000000000000, 0X00FF000000000000,
+   0X00FF000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X4080000000000000,
+   0X8080808080808080},
+  // Define masks of lines through a8 and each square.
+  {0X0101010101010101, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0102040810204080, 0X0101010101010101,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0102040810204080,
+   0X0000000000000000, 0X0101010101010101, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0102040810204080, 0X0000000000000000, 0X0000000000000000,
+   0X0101010101010101, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0102040810204080, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0101010101010101,
+   0X0000000000000000, 0X0000000000000000, 0X0102040810204080,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0101010101010101, 0X0000000000000000,
+   0X0102040810204080, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0101010101010101, 0X0102040810204080, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0XFF00000000000000, 0XFF00000000000000, 0XFF00000000000000,
+   0XFF00000000000000, 0XFF00000000000000, 0XFF00000000000000,
+   0XFF00000000000000},
+  // Define masks of lines through b8 and each square.
+  {0X0000000000000000, 0X0202020202020202, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0202020202020202, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0204081020408000, 0X0000000000000000, 0X0202020202020202,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0204081020408000, 0X0000000000000000,
+   0X0000000000000000, 0X0202020202020202, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0204081020408000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0202020202020202, 0X0000000000000000, 0X0000000000000000,
+   0X0204081020408000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0202020202020202,
+   0X0000000000000000, 0X0204081020408000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0201000000000000, 0X0202020202020202, 0X0204081020408000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0XFF00000000000000,
+   0X0000000000000000, 0XFF00000000000000, 0XFF00000000000000,
+   0XFF00000000000000, 0XFF00000000000000, 0XFF00000000000000,
+   0XFF00000000000000},
+  // Define masks of lines through c8 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0404040404040404,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0404040404040404, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0404040404040404, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0408102040800000,
+   0X0000000000000000, 0X0000000000000000, 0X0404040404040404,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0408102040800000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0404040404040404, 0X0000000000000000,
+   0X0000000000000000, 0X0408102040800000, 0X0000000000000000,
+   0X0000000000000000, 0X0402010000000000, 0X0000000000000000,
+   0X0404040404040404, 0X0000000000000000, 0X0408102040800000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0402010000000000, 0X0404040404040404,
+   0X0408102040800000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0XFF00000000000000,
+   0XFF00000000000000, 0X0000000000000000, 0XFF00000000000000,
+   0XFF00000000000000, 0XFF00000000000000, 0XFF00000000000000,
+   0XFF00000000000000},
+  // Define masks of lines through d8 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0808080808080808, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0808080808080808,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0808080808080808, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0808080808080808, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0810204080000000, 0X0804020100000000,
+   0X0000000000000000, 0X0000000000000000, 0X0808080808080808,
+   0X0000000000000000, 0X0000000000000000, 0X0810204080000000,
+   0X0000000000000000, 0X0000000000000000, 0X0804020100000000,
+   0X0000000000000000, 0X0808080808080808, 0X0000000000000000,
+   0X0810204080000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0804020100000000,
+   0X0808080808080808, 0X0810204080000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0XFF00000000000000,
+   0XFF00000000000000, 0XFF00000000000000, 0X0000000000000000,
+   0XFF00000000000000, 0XFF00000000000000, 0XFF00000000000000,
+   0XFF00000000000000},
+  // Define masks of lines through e8 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X1010101010101010, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X1010101010101010, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X1010101010101010,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X1008040201000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X1010101010101010, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X1008040201000000, 0X0000000000000000, 0X0000000000000000,
+   0X1010101010101010, 0X0000000000000000, 0X0000000000000000,
+   0X1020408000000000, 0X0000000000000000, 0X0000000000000000,
+   0X1008040201000000, 0X0000000000000000, 0X1010101010101010,
+   0X0000000000000000, 0X1020408000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X1008040201000000, 0X1010101010101010, 0X1020408000000000,
+   0X0000000000000000, 0X0000000000000000, 0XFF00000000000000,
+   0XFF00000000000000, 0XFF00000000000000, 0XFF00000000000000,
+   0X0000000000000000, 0XFF00000000000000, 0XFF00000000000000,
+   0XFF00000000000000},
+  // Define masks of lines through f8 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X2020202020202020,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X2020202020202020, 0X0000000000000000,
+   0X0000000000000000, 0X2010080402010000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X2020202020202020, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X2010080402010000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X2020202020202020,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X2010080402010000, 0X0000000000000000,
+   0X0000000000000000, 0X2020202020202020, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X2010080402010000, 0X0000000000000000,
+   0X2020202020202020, 0X0000000000000000, 0X2040800000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X2010080402010000, 0X2020202020202020,
+   0X2040800000000000, 0X0000000000000000, 0XFF00000000000000,
+   0XFF00000000000000, 0XFF00000000000000, 0XFF00000000000000,
+   0XFF00000000000000, 0X0000000000000000, 0XFF00000000000000,
+   0XFF00000000000000},
+  // Define masks of lines through g8 and each square.
+  {0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X4040404040404040, 0X0000000000000000, 0X4020100804020100,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X4040404040404040,
+   0X0000000000000000, 0X0000000000000000, 0X4020100804020100,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X4040404040404040, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X4020100804020100,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X4040404040404040, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X4020100804020100,
+   0X0000000000000000, 0X0000000000000000, 0X4040404040404040,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X4020100804020100,
+   0X0000000000000000, 0X4040404040404040, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X4020100804020100,
+   0X4040404040404040, 0X4080000000000000, 0XFF00000000000000,
+   0XFF00000000000000, 0XFF00000000000000, 0XFF00000000000000,
+   0XFF00000000000000, 0XFF00000000000000, 0X0000000000000000,
+   0XFF00000000000000},
+  // Define masks of lines through h8 and each square.
+  {0X8040201008040201, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X8080808080808080, 0X0000000000000000,
+   0X8040201008040201, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X8080808080808080, 0X0000000000000000, 0X0000000000000000,
+   0X8040201008040201, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X8080808080808080,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X8040201008040201, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X8080808080808080, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X8040201008040201, 0X0000000000000000, 0X0000000000000000,
+   0X8080808080808080, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X8040201008040201, 0X0000000000000000, 0X8080808080808080,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X0000000000000000, 0X0000000000000000, 0X0000000000000000,
+   0X8040201008040201, 0X8080808080808080, 0XFF00000000000000,
+   0XFF00000000000000, 0XFF00000000000000, 0XFF00000000000000,
+   0XFF00000000000000, 0XFF00000000000000, 0XFF00000000000000,
+   0X0000000000000000}
+};
+
 } // namespace omegazero
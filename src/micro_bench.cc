@@ -0,0 +1,340 @@
+/* Noah Himed
+ *
+ * Implement a standalone microbenchmark of the board and engine primitives on
+ * the hot path of the search, timing each one over the benchmark positions
+ * and counting the heap allocations it makes. It is built as its own binary
+ * by "make bench-micro", since allocations are counted by replacing the
+ * global operator new.
+ *
+ * Licensed under MIT License. Terms and conditions enclosed in "LICENSE.txt".
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "bad_move.h"
+#include "bench.h"
+#include "board.h"
+#include "engine.h"
+#include "move.h"
+#include "transposition_table.h"
+
+namespace omegazero {
+
+using std::cout;
+using std::endl;
+using std::invalid_argument;
+using std::setw;
+using std::string;
+using std::vector;
+using std::chrono::duration;
+using std::chrono::duration_cast;
+using std::chrono::high_resolution_clock;
+
+// Store the number of allocations made through operator new.
+U64 num_allocations = 0;
+
+}  // namespace omegazero
+
+auto operator new(size_t size) -> void* {
+  ++omegazero::num_allocations;
+  if (void* ptr = std::malloc(size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+auto operator new(size_t size, std::align_val_t alignment) -> void* {
+  ++omegazero::num_allocations;
+  // Round the size up to a multiple of the alignment, as aligned_alloc()
+  // requires.
+  size_t align = static_cast<size_t>(alignment);
+  size_t aligned_size = (size + align - 1) / align * align;
+  if (void* ptr = std::aligned_alloc(align, aligned_size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+auto operator delete(void* ptr) noexcept -> void { std::free(ptr); }
+
+auto operator delete(void* ptr, size_t) noexcept -> void { std::free(ptr); }
+
+auto operator delete(void* ptr, std::align_val_t) noexcept -> void {
+  std::free(ptr);
+}
+
+auto operator delete(void* ptr, size_t, std::align_val_t) noexcept -> void {
+  std::free(ptr);
+}
+
+namespace omegazero {
+
+namespace {
+
+constexpr int kDefaultMicroBenchRounds = 50;
+// Store the number of times cheap operations are repeated per position, so
+// that reading the clock doesn't dominate their time.
+constexpr int kNumRepeats = 16;
+// Store the size of the buffer written to evict the transposition table from
+// the caches, which must exceed the size of the last level cache.
+constexpr size_t kCacheFlushSize = 256 << 20;
+
+// Store the time and allocations of one operation.
+struct MicroBenchResult {
+  double ns_per_op;
+  double allocations_per_op;
+};
+
+// Store the sum of benchmark results, which keeps the benchmarked calls from
+// being optimized away.
+U64 checksum = 0;
+
+// Run a benchmark over every benchmark position for the given number of
+// rounds. Before each position, setup is called untimed with the board set to
+// the position; run_pos is then timed, returning the number of operations it
+// performed.
+template <typename Setup, typename RunPos>
+auto TimeOp(Board& board, int num_rounds, Setup setup, RunPos run_pos)
+    -> MicroBenchResult {
+  double total_time = 0.0;
+  U64 total_allocations = 0;
+  U64 num_ops = 0;
+  for (int round = 0; round < num_rounds; ++round) {
+    for (int pos_idx = 0; pos_idx < kNumBenchPositions; ++pos_idx) {
+      board.SetPos(kBenchPositions[pos_idx]);
+      setup(pos_idx);
+      U64 start_allocations = num_allocations;
+      high_resolution_clock::time_point start = high_resolution_clock::now();
+      num_ops += run_pos(pos_idx);
+      total_time += duration_cast<duration<double, std::nano>>(
+                        high_resolution_clock::now() - start)
+                        .count();
+      total_allocations += num_allocations - start_allocations;
+    }
+  }
+  return {total_time / static_cast<double>(num_ops),
+          static_cast<double>(total_allocations) /
+              static_cast<double>(num_ops)};
+}
+
+auto OutputResult(const string& label, const MicroBenchResult& result)
+    -> void {
+  cout << std::left << setw(36) << label << std::right << std::fixed
+       << std::setprecision(1) << setw(10) << result.ns_per_op << " ns/op"
+       << std::setprecision(2) << setw(8) << result.allocations_per_op
+       << " allocs/op" << endl;
+}
+
+// Output the result of an operation timed together with making and unmaking
+// each move, less the time and allocations of making and unmaking alone.
+auto OutputMoveResult(const string& label, const MicroBenchResult& result,
+                      const MicroBenchResult& make_unmake_result) -> void {
+  OutputResult(label, {result.ns_per_op - make_unmake_result.ns_per_op,
+                       result.allocations_per_op -
+                           make_unmake_result.allocations_per_op});
+}
+
+auto RunMicroBench(int num_rounds) -> void {
+  if (num_rounds < 1) {
+    throw invalid_argument("Number of microbenchmark rounds must be at least "
+                           "one");
+  }
+
+  Board board(kBenchPositions[0]);
+  SearchOptions search_options;
+  search_options.verbose = false;
+  constexpr float kUnusedSearchTime = 1.0f;
+  constexpr char kUnusedUserSide = 'w';
+  Engine engine(&board, kUnusedUserSide, kUnusedSearchTime, search_options);
+  TranspositionTable transposition_table;
+
+  // Find the legal moves of each position up front.
+  vector<vector<Move>> legal_moves(kNumBenchPositions);
+  for (int pos_idx = 0; pos_idx < kNumBenchPositions; ++pos_idx) {
+    board.SetPos(kBenchPositions[pos_idx]);
+    for (const Move& move : engine.GenerateMoves()) {
+      try {
+        board.MakeMove(move);
+      } catch (BadMove& e) {
+        continue;
+      }
+      board.UnmakeMove(move);
+      legal_moves[pos_idx].push_back(move);
+    }
+  }
+  auto no_setup = [](int) {};
+
+  cout << "Positions: " << kNumBenchPositions << " x " << num_rounds
+       << " rounds\n"
+       << endl;
+  const string kPieceNames[kNumPieceTypes] = {"pawn", "knight", "bishop",
+                                              "rook", "queen",  "king"};
+  for (S8 piece = kPawn; piece <= kKing; ++piece) {
+    OutputResult("GetAttackMap (" + kPieceNames[piece] + ")",
+                 TimeOp(board, num_rounds, no_setup, [&](int) {
+                   S8 player = board.GetPlayerToMove();
+                   for (S8 sq = kSqA1; sq <= kSqH8; ++sq) {
+                     checksum += board.GetAttackMap(player, sq, piece);
+                   }
+                   return static_cast<U64>(kNumSq);
+                 }));
+  }
+
+  auto make_unmake = [&](int pos_idx) {
+    for (const Move& move : legal_moves[pos_idx]) {
+      board.MakeMove(move);
+      board.UnmakeMove(move);
+    }
+    return static_cast<U64>(legal_moves[pos_idx].size());
+  };
+  MicroBenchResult make_unmake_result =
+      TimeOp(board, num_rounds, no_setup, make_unmake);
+  OutputResult("MakeMove + UnmakeMove", make_unmake_result);
+
+  // Time operations on the positions one move away from each benchmark
+  // position, subtracting the time spent making and unmaking the moves.
+  auto time_after_moves = [&](auto setup, auto op) {
+    return TimeOp(board, num_rounds, setup, [&](int pos_idx) {
+      for (const Move& move : legal_moves[pos_idx]) {
+        board.MakeMove(move);
+        op();
+        board.UnmakeMove(move);
+      }
+      return static_cast<U64>(legal_moves[pos_idx].size());
+    });
+  };
+  auto clear_caches = [&](int) {
+    board.ClearEvalCache();
+    board.ClearPawnTable();
+  };
+  auto evaluate = [&]() { checksum += static_cast<U64>(board.Evaluate()); };
+  OutputMoveResult("Evaluate (eval cache misses)",
+                   time_after_moves(clear_caches, evaluate),
+                   make_unmake_result);
+  OutputMoveResult("Evaluate (eval cache hits)",
+                   time_after_moves(no_setup, evaluate), make_unmake_result);
+  OutputMoveResult("EvaluatePawnStructure",
+                   time_after_moves(no_setup,
+                                    [&]() {
+                                      checksum += static_cast<U64>(
+                                          board.EvaluatePawnStructure());
+                                    }),
+                   make_unmake_result);
+
+  // Time move generation and ordering at the benchmark positions themselves.
+  auto repeat = [&](auto op) {
+    return [op](int) {
+      for (int repeat_idx = 0; repeat_idx < kNumRepeats; ++repeat_idx) {
+        op();
+      }
+      return static_cast<U64>(kNumRepeats);
+    };
+  };
+  OutputResult("GenerateMoves (all moves)",
+               TimeOp(board, num_rounds, no_setup, repeat([&]() {
+                        checksum += engine.GenerateMoves().size();
+                      })));
+  OutputResult("GenerateMoves (captures only)",
+               TimeOp(board, num_rounds, no_setup, repeat([&]() {
+                        checksum += engine.GenerateMoves(true).size();
+                      })));
+  vector<Move> move_list;
+  vector<int> move_scores;
+  OutputResult("GenerateMoves (reused buffer)",
+               TimeOp(board, num_rounds, no_setup, repeat([&]() {
+                        engine.GenerateMoves(move_list);
+                        checksum += move_list.size();
+                      })));
+  auto generate_moves = [&](int) { move_list = engine.GenerateMoves(); };
+  auto order_moves = [&]() {
+    engine.OrderMoves(move_list, move_scores, 0);
+    checksum += move_list.front().target_sq;
+  };
+  OutputResult("OrderMoves", TimeOp(board, num_rounds, generate_moves,
+                                    repeat(order_moves)));
+
+  // Store an entry for every position one move away, then look them up.
+  constexpr int kTableDepth = 4;
+  OutputMoveResult("TranspositionTable::Update",
+                   time_after_moves(no_setup,
+                                    [&]() {
+                                      transposition_table.Update(
+                                          &board, kTableDepth, kNeutralEval,
+                                          kPvNode);
+                                    }),
+                   make_unmake_result);
+  OutputMoveResult("TranspositionTable::Access",
+                   time_after_moves(no_setup,
+                                    [&]() {
+                                      int eval;
+                                      S8 node_type;
+                                      checksum += transposition_table.Access(
+                                          &board, kTableDepth, eval, node_type);
+                                    }),
+                   make_unmake_result);
+
+  // Look up the positions one move away with the table evicted from the
+  // caches, as in a search with a table much larger than the caches, with and
+  // without first prefetching the entries of the position the move leads to.
+  // The caches are flushed once per round, which is enough since each entry
+  // is read once per round. Making and unmaking the moves is included in the
+  // times, since it is also slowed down by the flush.
+  vector<U64> cache_flush_buffer(kCacheFlushSize / sizeof(U64));
+  auto flush_caches = [&](int pos_idx) {
+    if (pos_idx == 0) {
+      for (U64& val : cache_flush_buffer) {
+        ++val;
+      }
+      checksum += cache_flush_buffer.back();
+    }
+  };
+  auto access_cold_table = [&](bool prefetch) {
+    return TimeOp(board, num_rounds, flush_caches, [&](int pos_idx) {
+      for (const Move& move : legal_moves[pos_idx]) {
+        if (prefetch) {
+          U64 child_pawn_hash;
+          transposition_table.Prefetch(
+              board.GetChildHash(move, child_pawn_hash));
+        }
+        board.MakeMove(move);
+        int eval;
+        S8 node_type;
+        checksum += transposition_table.Access(&board, kTableDepth, eval,
+                                               node_type);
+        board.UnmakeMove(move);
+      }
+      return static_cast<U64>(legal_moves[pos_idx].size());
+    });
+  };
+  OutputResult("Make + Access + Unmake (cold)", access_cold_table(false));
+  OutputResult("Make + Access + Unmake (prefetched)", access_cold_table(true));
+
+  cout << "\nChecksum: " << checksum << endl;
+}
+
+}  // namespace
+
+}  // namespace omegazero
+
+auto main(int argc, char* argv[]) -> int {
+  try {
+    int num_rounds = omegazero::kDefaultMicroBenchRounds;
+    if (argc > 1) {
+      num_rounds = std::stoi(argv[1]);
+    }
+    omegazero::RunMicroBench(num_rounds);
+  } catch (std::invalid_argument& e) {
+    std::cout << "ERROR: Invalid argument: " << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
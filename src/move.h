@@ -14,6 +14,7 @@
 namespace omegazero {
 
 typedef int8_t S8;
+typedef uint64_t U64;
 
 constexpr S8 kNA = -1;
 
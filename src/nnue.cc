@@ -0,0 +1,236 @@
+/* Noah Himed
+ *
+ * Implement the NNUE evaluation network, using AVX2 integer instructions when
+ * the build targets them.
+ *
+ * Licensed under MIT License. Terms and conditions enclosed in "LICENSE.txt".
+ */
+
+#include "nnue.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace omegazero {
+
+using std::clamp;
+using std::copy;
+using std::ifstream;
+using std::invalid_argument;
+using std::string;
+using std::vector;
+
+namespace {
+
+// Store the number of bits hidden layer outputs are shifted right by to undo
+// the scaling of their weights, and the factor the output is divided by to
+// convert it to centipawns.
+constexpr int kWeightScaleBits = 6;
+constexpr int kOutputScale = 16;
+// Store the largest activation of the clipped ReLU layers.
+constexpr int kMaxActivation = 127;
+
+// Read an array of little-endian values from a network file.
+template <typename T>
+auto ReadValues(ifstream& network_f, vector<T>& values, size_t num_values)
+    -> void {
+  values.resize(num_values);
+  network_f.read(reinterpret_cast<char*>(values.data()),
+                 static_cast<std::streamsize>(num_values * sizeof(T)));
+  if (!network_f) {
+    throw invalid_argument("NNUE network file is truncated");
+  }
+}
+
+// Compute the outputs of a fully connected layer, with weights stored one row
+// of kInputDims weights per output.
+template <int kInputDims>
+auto PropagateAffine(const U8* input, const int8_t* weights,
+                     const S32* biases, int output_dims, S32* output) -> void {
+  for (int output_idx = 0; output_idx < output_dims; ++output_idx) {
+    const int8_t* row = weights + output_idx * kInputDims;
+#if defined(__AVX2__)
+    // Multiply and add pairs of unsigned inputs and signed weights into 16 bit
+    // sums, then widen those into 32 bit sums.
+    static_assert(kInputDims % 32 == 0, "AVX2 input must fill registers");
+    const __m256i kOnes = _mm256_set1_epi16(1);
+    __m256i sum = _mm256_setzero_si256();
+    for (int input_idx = 0; input_idx < kInputDims; input_idx += 32) {
+      __m256i input_chunk = _mm256_loadu_si256(
+          reinterpret_cast<const __m256i*>(input + input_idx));
+      __m256i weight_chunk = _mm256_loadu_si256(
+          reinterpret_cast<const __m256i*>(row + input_idx));
+      __m256i products = _mm256_maddubs_epi16(input_chunk, weight_chunk);
+      sum = _mm256_add_epi32(sum, _mm256_madd_epi16(products, kOnes));
+    }
+    __m128i half_sum = _mm_add_epi32(_mm256_castsi256_si128(sum),
+                                     _mm256_extracti128_si256(sum, 1));
+    half_sum = _mm_add_epi32(half_sum, _mm_shuffle_epi32(half_sum, 0X4E));
+    half_sum = _mm_add_epi32(half_sum, _mm_shuffle_epi32(half_sum, 0XB1));
+    output[output_idx] = biases[output_idx] + _mm_cvtsi128_si32(half_sum);
+#else
+    S32 sum = biases[output_idx];
+    for (int input_idx = 0; input_idx < kInputDims; ++input_idx) {
+      sum += input[input_idx] * row[input_idx];
+    }
+    output[output_idx] = sum;
+#endif
+  }
+}
+
+// Scale layer outputs back down and clip them to [0, kMaxActivation].
+auto ClipActivations(const S32* input, int num_dims, U8* output) -> void {
+  for (int idx = 0; idx < num_dims; ++idx) {
+    output[idx] = static_cast<U8>(
+        clamp(input[idx] >> kWeightScaleBits, 0, kMaxActivation));
+  }
+}
+
+}  // namespace
+
+auto NnueNetwork::Load(const string& network_path) -> void {
+  ifstream network_f(network_path, std::ios::binary);
+  if (!network_f.is_open()) {
+    throw invalid_argument("NNUE network file can't be opened");
+  }
+
+  // Check that the header matches the dimensions of the network.
+  char magic[4];
+  uint32_t header[5];
+  network_f.read(magic, sizeof(magic));
+  network_f.read(reinterpret_cast<char*>(header), sizeof(header));
+  const uint32_t kExpectedHeader[5] = {kNnueFileVersion, kNnueNumFeatures,
+                                       kNnueHalfDims, kNnueHidden1Dims,
+                                       kNnueHidden2Dims};
+  if (!network_f || memcmp(magic, "OZNN", sizeof(magic)) != 0) {
+    throw invalid_argument("NNUE network file has an invalid header");
+  }
+  if (!std::equal(header, header + 5, kExpectedHeader)) {
+    throw invalid_argument(
+        "NNUE network file version or dimensions don't match the engine");
+  }
+
+  ReadValues(network_f, feature_biases_, kNnueHalfDims);
+  ReadValues(network_f, feature_weights_,
+             static_cast<size_t>(kNnueNumFeatures) * kNnueHalfDims);
+  ReadValues(network_f, hidden1_biases_, kNnueHidden1Dims);
+  ReadValues(network_f, hidden1_weights_, kNnueHidden1Dims * 2 * kNnueHalfDims);
+  ReadValues(network_f, hidden2_biases_, kNnueHidden2Dims);
+  ReadValues(network_f, hidden2_weights_, kNnueHidden2Dims * kNnueHidden1Dims);
+  vector<S32> output_bias;
+  ReadValues(network_f, output_bias, 1);
+  output_bias_ = output_bias[0];
+  ReadValues(network_f, output_weights_, kNnueHidden2Dims);
+  if (network_f.peek() != ifstream::traits_type::eof()) {
+    throw invalid_argument("NNUE network file has trailing data");
+  }
+}
+
+auto NnueNetwork::ResetAccumulator(NnueAccumulator& accumulator,
+                                   int perspective) const -> void {
+  copy(feature_biases_.begin(), feature_biases_.end(),
+       accumulator.values[perspective]);
+}
+
+auto NnueNetwork::AddFeature(NnueAccumulator& accumulator, int perspective,
+                             int feature_idx) const -> void {
+  S16* values = accumulator.values[perspective];
+  const S16* column = feature_weights_.data() +
+                      static_cast<size_t>(feature_idx) * kNnueHalfDims;
+#if defined(__AVX2__)
+  for (int idx = 0; idx < kNnueHalfDims; idx += 16) {
+    __m256i* value_chunk = reinterpret_cast<__m256i*>(values + idx);
+    *value_chunk = _mm256_add_epi16(
+        *value_chunk,
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(column + idx)));
+  }
+#else
+  for (int idx = 0; idx < kNnueHalfDims; ++idx) {
+    values[idx] += column[idx];
+  }
+#endif
+}
+
+auto NnueNetwork::SubtractFeature(NnueAccumulator& accumulator,
+                                  int perspective, int feature_idx) const
+    -> void {
+  S16* values = accumulator.values[perspective];
+  const S16* column = feature_weights_.data() +
+                      static_cast<size_t>(feature_idx) * kNnueHalfDims;
+#if defined(__AVX2__)
+  for (int idx = 0; idx < kNnueHalfDims; idx += 16) {
+    __m256i* value_chunk = reinterpret_cast<__m256i*>(values + idx);
+    *value_chunk = _mm256_sub_epi16(
+        *value_chunk,
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(column + idx)));
+  }
+#else
+  for (int idx = 0; idx < kNnueHalfDims; ++idx) {
+    values[idx] -= column[idx];
+  }
+#endif
+}
+
+auto NnueNetwork::Evaluate(const NnueAccumulator& accumulator,
+                           int player_to_move) const -> int {
+  // Clip the accumulators of the player to move and the other player, in that
+  // order, to form the input of the hidden layers.
+  alignas(32) U8 transformed[2 * kNnueHalfDims];
+  const int perspectives[2] = {player_to_move, 1 - player_to_move};
+  for (int half = 0; half < 2; ++half) {
+    const S16* values = accumulator.values[perspectives[half]];
+    U8* half_output = transformed + half * kNnueHalfDims;
+#if defined(__AVX2__)
+    // Pack pairs of 16 bit registers into 8 bits with unsigned saturation,
+    // then undo the lane interleaving of the pack.
+    const __m256i kMax = _mm256_set1_epi16(kMaxActivation);
+    for (int idx = 0; idx < kNnueHalfDims; idx += 32) {
+      __m256i low = _mm256_min_epi16(
+          _mm256_load_si256(reinterpret_cast<const __m256i*>(values + idx)),
+          kMax);
+      __m256i high = _mm256_min_epi16(
+          _mm256_load_si256(
+              reinterpret_cast<const __m256i*>(values + idx + 16)),
+          kMax);
+      __m256i packed = _mm256_permute4x64_epi64(
+          _mm256_packus_epi16(low, high), 0XD8);
+      _mm256_store_si256(reinterpret_cast<__m256i*>(half_output + idx),
+                         packed);
+    }
+#else
+    for (int idx = 0; idx < kNnueHalfDims; ++idx) {
+      half_output[idx] = static_cast<U8>(
+          clamp(static_cast<int>(values[idx]), 0, kMaxActivation));
+    }
+#endif
+  }
+
+  alignas(32) S32 hidden1_sums[kNnueHidden1Dims];
+  alignas(32) U8 hidden1_output[kNnueHidden1Dims];
+  PropagateAffine<2 * kNnueHalfDims>(transformed, hidden1_weights_.data(),
+                                     hidden1_biases_.data(), kNnueHidden1Dims,
+                                     hidden1_sums);
+  ClipActivations(hidden1_sums, kNnueHidden1Dims, hidden1_output);
+
+  alignas(32) S32 hidden2_sums[kNnueHidden2Dims];
+  alignas(32) U8 hidden2_output[kNnueHidden2Dims];
+  PropagateAffine<kNnueHidden1Dims>(hidden1_output, hidden2_weights_.data(),
+                                    hidden2_biases_.data(), kNnueHidden2Dims,
+                                    hidden2_sums);
+  ClipActivations(hidden2_sums, kNnueHidden2Dims, hidden2_output);
+
+  S32 output;
+  PropagateAffine<kNnueHidden2Dims>(hidden2_output, output_weights_.data(),
+                                    &output_bias_, 1, &output);
+  return output / kOutputScale;
+}
+
+}  // namespace omegazero
@@ -0,0 +1,119 @@
+/* Noah Himed
+ *
+ * Define the NnueNetwork type, an efficiently updatable neural network (NNUE)
+ * that can replace the hand-crafted evaluation. Its first layer is a HalfKP
+ * feature transformer: each side's half of the layer is indexed by that side's
+ * king square together with the square of every other non-king piece. Since a
+ * move only changes a few features, the first layer's outputs are kept in
+ * accumulators that are updated by adding and subtracting weight columns,
+ * with one accumulator per ply so that unmaking a move is free.
+ *
+ * Licensed under MIT License. Terms and conditions enclosed in "LICENSE.txt".
+ */
+
+#ifndef OMEGAZERO_SRC_NNUE_H_
+#define OMEGAZERO_SRC_NNUE_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "move.h"
+
+namespace omegazero {
+
+using std::string;
+using std::vector;
+
+typedef int16_t S16;
+typedef int32_t S32;
+typedef uint8_t U8;
+
+// Store the dimensions of the network. Features are indexed by the oriented
+// king square, then by the piece (5 non-king piece types for each of 2
+// players) and its oriented square.
+constexpr int kNnueNumPieceFeatures = 10 * 64;
+constexpr int kNnueNumFeatures = 64 * kNnueNumPieceFeatures;
+constexpr int kNnueHalfDims = 256;
+constexpr int kNnueHidden1Dims = 32;
+constexpr int kNnueHidden2Dims = 32;
+
+// Store the file format version written in network file headers.
+constexpr uint32_t kNnueFileVersion = 1;
+
+// Store the outputs of the feature transformer from each player's
+// perspective, indexed by player (0 for White and 1 for Black).
+struct NnueAccumulator {
+  alignas(32) S16 values[2][kNnueHalfDims];
+  bool computed[2];
+};
+
+// Store a piece moved, added (from_sq is kNA), or removed (to_sq is kNA) by a
+// move, for updating accumulators.
+struct NnueDirtyPiece {
+  S8 piece;
+  S8 player;
+  S8 from_sq;
+  S8 to_sq;
+};
+
+// Store the accumulator of a ply along with the pieces changed by the move
+// leading to it. A move changes at most three pieces: the moving piece, a
+// captured piece, and a castling rook.
+struct NnueStackEntry {
+  NnueAccumulator accumulator;
+  NnueDirtyPiece dirty_pieces[3];
+  int num_dirty_pieces;
+};
+
+class NnueNetwork {
+ public:
+  // Load the weights of a network file, throwing invalid_argument if the file
+  // can't be read or doesn't match the dimensions above.
+  auto Load(const string& network_path) -> void;
+
+  // Return the index of the feature of a piece from a player's perspective.
+  // Squares are mirrored vertically for Black so that each player sees the
+  // board from their own side. Pieces and players are numbered as in board.h.
+  static auto GetFeatureIdx(int perspective, int king_sq, int piece,
+                            int player, int sq) -> int;
+
+  // Set a perspective of an accumulator to the biases, before adding the
+  // features of every piece.
+  auto ResetAccumulator(NnueAccumulator& accumulator, int perspective) const
+      -> void;
+  auto AddFeature(NnueAccumulator& accumulator, int perspective,
+                  int feature_idx) const -> void;
+  auto SubtractFeature(NnueAccumulator& accumulator, int perspective,
+                       int feature_idx) const -> void;
+
+  // Run the layers after the feature transformer, returning the evaluation in
+  // centipawns relative to the player to move.
+  auto Evaluate(const NnueAccumulator& accumulator, int player_to_move) const
+      -> int;
+
+ private:
+  vector<S16> feature_biases_;
+  vector<S16> feature_weights_;
+  vector<S32> hidden1_biases_;
+  vector<int8_t> hidden1_weights_;
+  vector<S32> hidden2_biases_;
+  vector<int8_t> hidden2_weights_;
+  S32 output_bias_;
+  vector<int8_t> output_weights_;
+};
+
+inline auto NnueNetwork::GetFeatureIdx(int perspective, int king_sq, int piece,
+                                       int player, int sq) -> int {
+  constexpr int kNumSqs = 64;
+  // Mirror squares vertically for Black by flipping the rank bits.
+  constexpr int kBlackOrientation = 56;
+  int orientation = (perspective == 0) ? 0 : kBlackOrientation;
+  int piece_idx = piece * 2 + (player != perspective);
+  return (king_sq ^ orientation) * kNnueNumPieceFeatures + piece_idx * kNumSqs +
+         (sq ^ orientation);
+}
+
+}  // namespace omegazero
+
+#endif  // OMEGAZERO_SRC_NNUE_H_
@@ -0,0 +1,209 @@
+/* Noah Himed
+ *
+ * Implement the OpeningBook type.
+ *
+ * Licensed under MIT License. Terms and conditions enclosed in "LICENSE.txt".
+ */
+
+#include "opening_book.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "board.h"
+#include "move.h"
+
+namespace omegazero {
+
+using std::invalid_argument;
+using std::ios;
+using std::ofstream;
+using std::random_device;
+using std::sort;
+using std::string;
+using std::uniform_int_distribution;
+using std::vector;
+
+namespace {
+
+constexpr size_t kBookEntrySize = 16;
+
+// Read an unsigned integer stored in big-endian byte order.
+auto ReadBigEndian(const unsigned char* data, size_t num_bytes) -> U64 {
+  U64 val = 0;
+  for (size_t byte_idx = 0; byte_idx < num_bytes; ++byte_idx) {
+    val = (val << 8) | data[byte_idx];
+  }
+  return val;
+}
+
+auto WriteBigEndian(ofstream& book_f, U64 val, size_t num_bytes) -> void {
+  for (size_t byte_idx = num_bytes; byte_idx > 0; --byte_idx) {
+    book_f.put(static_cast<char>((val >> (8 * (byte_idx - 1))) & 0XFF));
+  }
+}
+
+}  // namespace
+
+auto EncodeBookMove(const Move& move, S8 moving_player) -> U16 {
+  S8 start_sq;
+  S8 target_sq;
+  if (move.castling_type == kNA) {
+    start_sq = move.start_sq;
+    target_sq = move.target_sq;
+  } else if (moving_player == kWhite) {
+    start_sq = kSqE1;
+    target_sq = (move.castling_type == kKingSide) ? kSqH1 : kSqA1;
+  } else {
+    start_sq = kSqE8;
+    target_sq = (move.castling_type == kKingSide) ? kSqH8 : kSqA8;
+  }
+
+  // Store promotions by the Piece value of the promoted to piece, which is
+  // never zero.
+  U16 promotion_code =
+      (move.promoted_to_piece == kNA) ? 0 : move.promoted_to_piece;
+  return static_cast<U16>(target_sq | (start_sq << 6) | (promotion_code << 12));
+}
+
+auto WriteOpeningBook(vector<BookEntry> book_entries, const string& book_path)
+    -> void {
+  sort(book_entries.begin(), book_entries.end(),
+       [](const BookEntry& lhs, const BookEntry& rhs) {
+         if (lhs.key != rhs.key) {
+           return lhs.key < rhs.key;
+         }
+         return lhs.weight > rhs.weight;
+       });
+
+  ofstream book_f(book_path, ios::binary);
+  if (!book_f.is_open()) {
+    throw invalid_argument("Opening book file can't be created");
+  }
+  for (const BookEntry& book_entry : book_entries) {
+    WriteBigEndian(book_f, book_entry.key, sizeof(book_entry.key));
+    WriteBigEndian(book_f, book_entry.move, sizeof(book_entry.move));
+    WriteBigEndian(book_f, book_entry.weight, sizeof(book_entry.weight));
+    WriteBigEndian(book_f, book_entry.learn, sizeof(book_entry.learn));
+  }
+  book_f.close();
+}
+
+OpeningBook::OpeningBook() {
+  book_data_ = nullptr;
+  book_size_ = 0;
+  num_entries_ = 0;
+}
+
+OpeningBook::~OpeningBook() { Close(); }
+
+auto OpeningBook::Open(const string& book_path) -> void {
+  Close();
+
+  int book_fd = open(book_path.c_str(), O_RDONLY);
+  if (book_fd < 0) {
+    throw invalid_argument("Opening book can't be opened");
+  }
+  struct stat book_stat;
+  if (fstat(book_fd, &book_stat) < 0 ||
+      book_stat.st_size % static_cast<off_t>(kBookEntrySize) != 0) {
+    close(book_fd);
+    throw invalid_argument("Opening book is not a valid book file");
+  }
+
+  book_size_ = static_cast<size_t>(book_stat.st_size);
+  num_entries_ = book_size_ / kBookEntrySize;
+  if (book_size_ > 0) {
+    void* book_map =
+        mmap(nullptr, book_size_, PROT_READ, MAP_PRIVATE, book_fd, 0);
+    if (book_map == MAP_FAILED) {
+      close(book_fd);
+      book_size_ = 0;
+      num_entries_ = 0;
+      throw invalid_argument("Opening book can't be memory mapped");
+    }
+    book_data_ = static_cast<const unsigned char*>(book_map);
+  }
+  // The mapping stays valid after the file descriptor is closed.
+  close(book_fd);
+
+  random_device dev;
+  rng_.seed(dev());
+}
+
+auto OpeningBook::GetBookMove(U64 board_hash, U16& book_move) -> bool {
+  // Binary search for the first entry with the given key.
+  size_t low_idx = 0;
+  size_t high_idx = num_entries_;
+  while (low_idx < high_idx) {
+    size_t mid_idx = low_idx + (high_idx - low_idx) / 2;
+    if (GetEntry(mid_idx).key < board_hash) {
+      low_idx = mid_idx + 1;
+    } else {
+      high_idx = mid_idx;
+    }
+  }
+
+  // Pick a move with a probability proportional to its weight in a single
+  // pass over the position's entries, replacing the chosen move with each
+  // entry with a probability of its weight over the total weight seen so far.
+  // A move is also picked uniformly at random in the same pass, in case all of
+  // the moves have zero weight.
+  U32 total_weight = 0;
+  U32 num_pos_entries = 0;
+  U16 weighted_move = 0;
+  U16 uniform_move = 0;
+  for (size_t entry_idx = low_idx; entry_idx < num_entries_; ++entry_idx) {
+    BookEntry book_entry = GetEntry(entry_idx);
+    if (book_entry.key != board_hash) {
+      break;
+    }
+    ++num_pos_entries;
+    if (uniform_int_distribution<U32>(1, num_pos_entries)(rng_) == 1) {
+      uniform_move = book_entry.move;
+    }
+    total_weight += book_entry.weight;
+    if (book_entry.weight > 0 &&
+        uniform_int_distribution<U32>(1, total_weight)(rng_) <=
+            book_entry.weight) {
+      weighted_move = book_entry.move;
+    }
+  }
+  if (num_pos_entries == 0) {
+    return false;
+  }
+  book_move = (total_weight == 0) ? uniform_move : weighted_move;
+  return true;
+}
+
+auto OpeningBook::Close() -> void {
+  if (book_data_ != nullptr) {
+    munmap(const_cast<unsigned char*>(book_data_), book_size_);
+  }
+  book_data_ = nullptr;
+  book_size_ = 0;
+  num_entries_ = 0;
+}
+
+auto OpeningBook::GetEntry(size_t entry_idx) const -> BookEntry {
+  const unsigned char* entry_data = book_data_ + entry_idx * kBookEntrySize;
+  BookEntry book_entry;
+  book_entry.key = ReadBigEndian(entry_data, 8);
+  book_entry.move = static_cast<U16>(ReadBigEndian(entry_data + 8, 2));
+  book_entry.weight = static_cast<U16>(ReadBigEndian(entry_data + 10, 2));
+  book_entry.learn = static_cast<U32>(ReadBigEndian(entry_data + 12, 4));
+  return book_entry;
+}
+
+}  // namespace omegazero
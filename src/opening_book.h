@@ -0,0 +1,91 @@
+/* Noah Himed
+ *
+ * Define the OpeningBook type, a read-only binary opening book that is memory
+ * mapped from disk. Books are a list of 16 byte big-endian entries (key, move,
+ * weight, learn) sorted by key, allowing moves to be found with a binary
+ * search. Keys are OmegaZero's board hashes, so books are built by the engine
+ * itself with Game::BuildOpeningBook().
+ *
+ * Licensed under MIT License. Terms and conditions enclosed in "LICENSE.txt".
+ */
+
+#ifndef OMEGAZERO_SRC_OPENING_BOOK_H_
+#define OMEGAZERO_SRC_OPENING_BOOK_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "board.h"
+#include "move.h"
+
+namespace omegazero {
+
+using std::mt19937;
+using std::string;
+using std::vector;
+
+typedef uint16_t U16;
+typedef uint32_t U32;
+
+struct BookEntry {
+  // Store the board hash of the position the move is played from.
+  U64 key;
+  // Store the move encoded as described in EncodeBookMove().
+  U16 move;
+  // Store how often the move should be chosen relative to other moves from the
+  // same position.
+  U16 weight;
+  U32 learn;
+};
+
+// Encode a move made by the given player for a book entry: bits 0-5 store the
+// target square, bits 6-11 the start square, and bits 12-14 the promoted to
+// piece. Castling moves are encoded as the king moving onto its own rook.
+auto EncodeBookMove(const Move& move, S8 moving_player) -> U16;
+
+// Sort book entries by key and write them to a binary book file. Entries with
+// the same key are ordered by descending weight.
+auto WriteOpeningBook(vector<BookEntry> book_entries, const string& book_path)
+    -> void;
+
+class OpeningBook {
+ public:
+  OpeningBook();
+  ~OpeningBook();
+
+  OpeningBook(const OpeningBook&) = delete;
+  auto operator=(const OpeningBook&) -> OpeningBook& = delete;
+
+  // Memory map a binary book file, replacing any book already open.
+  auto Open(const string& book_path) -> void;
+
+  // Pick a random book move for the position with the given board hash, with
+  // each move weighted by its entry weight. Return false if the position isn't
+  // in the book.
+  auto GetBookMove(U64 board_hash, U16& book_move) -> bool;
+  auto GetNumEntries() const -> size_t;
+
+ private:
+  auto Close() -> void;
+  auto GetEntry(size_t entry_idx) const -> BookEntry;
+
+  const unsigned char* book_data_;
+  size_t book_size_;
+  size_t num_entries_;
+  // Store the generator used to pick between moves, seeded when a book is
+  // opened.
+  mt19937 rng_;
+};
+
+// Implement public inline member functions.
+
+inline auto OpeningBook::GetNumEntries() const -> size_t {
+  return num_entries_;
+}
+
+}  // namespace omegazero
+
+#endif  // OMEGAZERO_SRC_OPENING_BOOK_H_
@@ -10,11 +10,13 @@
 #define OMEGAZERO_SRC_PAWN_TABLE_H
 
 #include <algorithm>
-#include <cstdint>
 #include <cstring>
 #include <stdexcept>
 #include <vector>
 
+#include "move.h"
+#include "search_stats.h"
+
 namespace omegazero {
 
 using std::begin;
@@ -23,8 +25,6 @@ using std::end;
 using std::fill;
 using std::vector;
 
-typedef uint64_t U64;
-
 // Store a mask with least significant 19 bits set for computing table indices.
 constexpr int kPawnTableSize = 1 << 20;
 constexpr U64 kPawnHashMask = 0X7FFFF;
@@ -40,8 +40,19 @@ class PawnTable {
 
   auto Update(U64 pawn_hash, int pawn_eval) -> void;
   auto Clear() -> void;
+  // Start loading the entry of a pawn structure into the cache.
+  auto Prefetch(U64 pawn_hash) const -> void;
+
+  // Return the number of probes and hits recorded since the last call to
+  // ResetStats(). These are only recorded in builds with search statistics.
+  auto GetNumProbes() const -> U64;
+  auto GetNumHits() const -> U64;
+  auto ResetStats() -> void;
 
  private:
+  mutable U64 num_probes_ = 0;
+  mutable U64 num_hits_ = 0;
+
   // Store which slots in the table are occupied.
   vector<bool> occupancy_table_;
 
@@ -54,18 +65,20 @@ class PawnTable {
 };
 
 inline PawnTable::PawnTable() {
-  entries_.reserve(kPawnTableSize);
-  occupancy_table_.reserve(kPawnTableSize);
+  entries_.resize(kPawnTableSize);
+  occupancy_table_.resize(kPawnTableSize);
   // Initialize all slots intable_entry the occupancy table to unoccupied.
   Clear();
 }
 
 inline auto PawnTable::Access(U64 pawn_hash, int& pawn_eval) const -> bool {
+  RecordStat(num_probes_);
   int index = pawn_hash & kPawnHashMask;
   if (occupancy_table_[index]) {
     TableEntry entry = entries_[index];
     if (entry.pawn_hash == pawn_hash) {
       pawn_eval = entry.pawn_eval;
+      RecordStat(num_hits_);
       return true;
     }
   }
@@ -85,6 +98,19 @@ inline auto PawnTable::Clear() -> void {
   fill(occupancy_table_.begin(), occupancy_table_.end(), false);
 }
 
+inline auto PawnTable::Prefetch(U64 pawn_hash) const -> void {
+  __builtin_prefetch(&entries_[pawn_hash & kPawnHashMask]);
+}
+
+inline auto PawnTable::GetNumProbes() const -> U64 { return num_probes_; }
+
+inline auto PawnTable::GetNumHits() const -> U64 { return num_hits_; }
+
+inline auto PawnTable::ResetStats() -> void {
+  num_probes_ = 0;
+  num_hits_ = 0;
+}
+
 }  // namespace omegazero
 
 #endif  // OMEGAZERO_SRC_PAWN_TABLE_H
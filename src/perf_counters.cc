@@ -0,0 +1,161 @@
+/* Noah Himed
+ *
+ * Implement the hardware performance counters.
+ *
+ * Licensed under MIT License. Terms and conditions enclosed in "LICENSE.txt".
+ */
+
+#include "perf_counters.h"
+
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstring>
+#endif
+
+namespace omegazero {
+
+using std::cout;
+using std::endl;
+using std::runtime_error;
+using std::string;
+
+namespace {
+
+const string kPerfCounterNames[kNumPerfCounters] = {
+    "Cycles",     "Instructions",  "L1 data cache misses",
+    "LLC misses", "Branch misses", "dTLB misses"};
+
+#if defined(__linux__)
+// Store the event type and configuration of each counter. Cache events are
+// read misses.
+constexpr U64 kCacheReadMiss = (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                               (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+constexpr uint32_t kPerfEventTypes[kNumPerfCounters] = {
+    PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE,
+    PERF_TYPE_HW_CACHE, PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE};
+constexpr U64 kPerfEventConfigs[kNumPerfCounters] = {
+    PERF_COUNT_HW_CPU_CYCLES,
+    PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_CACHE_L1D | kCacheReadMiss,
+    PERF_COUNT_HW_CACHE_LL | kCacheReadMiss,
+    PERF_COUNT_HW_BRANCH_MISSES,
+    PERF_COUNT_HW_CACHE_DTLB | kCacheReadMiss};
+#endif
+
+}  // namespace
+
+PerfCounters::PerfCounters() {
+  bool any_opened = false;
+  for (int counter = 0; counter < kNumPerfCounters; ++counter) {
+    fds_[counter] = -1;
+#if defined(__linux__)
+    // Count user space events of the calling thread on any CPU. Counters are
+    // opened separately rather than as a group, so that an unsupported
+    // counter doesn't prevent the others from being read.
+    perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = kPerfEventTypes[counter];
+    attr.config = kPerfEventConfigs[counter];
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format =
+        PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    constexpr int kThisThread = 0;
+    constexpr int kAnyCpu = -1;
+    constexpr int kNoGroup = -1;
+    fds_[counter] = static_cast<int>(syscall(SYS_perf_event_open, &attr,
+                                             kThisThread, kAnyCpu, kNoGroup,
+                                             0));
+    any_opened = any_opened || fds_[counter] != -1;
+#endif
+  }
+
+  if (!any_opened) {
+    throw runtime_error("performance counters, which couldn't be opened "
+                        "(perf_event_open() may be unsupported or forbidden "
+                        "by kernel.perf_event_paranoid)");
+  }
+}
+
+PerfCounters::~PerfCounters() {
+#if defined(__linux__)
+  for (int fd : fds_) {
+    if (fd != -1) {
+      close(fd);
+    }
+  }
+#endif
+}
+
+auto PerfCounters::Start() -> void {
+#if defined(__linux__)
+  for (int fd : fds_) {
+    if (fd != -1) {
+      ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+  }
+#endif
+}
+
+auto PerfCounters::Stop() -> void {
+#if defined(__linux__)
+  for (int fd : fds_) {
+    if (fd != -1) {
+      ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+    }
+  }
+#endif
+}
+
+auto PerfCounters::Output(U64 num_nodes) const -> void {
+  cout << "\nPerformance counters (total, per node):" << endl;
+  for (int counter = 0; counter < kNumPerfCounters; ++counter) {
+    double count = Read(counter);
+    cout << "  " << std::left << std::setw(24) << kPerfCounterNames[counter]
+         << std::right;
+    if (count < 0.0) {
+      cout << std::setw(16) << "unavailable" << endl;
+      continue;
+    }
+    cout << std::fixed << std::setprecision(0) << std::setw(16) << count
+         << std::setprecision(2) << std::setw(12)
+         << count / static_cast<double>(num_nodes) << endl;
+  }
+
+  double cycles = Read(kCycles);
+  double instructions = Read(kInstructions);
+  if (cycles > 0.0 && instructions >= 0.0) {
+    cout << "  Instructions per cycle: " << std::setprecision(2)
+         << instructions / cycles << endl;
+  }
+}
+
+auto PerfCounters::Read(int counter) const -> double {
+#if defined(__linux__)
+  // Read the count along with the time the counter was enabled and the time
+  // it was actually counting, which differ when counters are multiplexed.
+  U64 values[3];
+  if (fds_[counter] != -1 &&
+      read(fds_[counter], values, sizeof(values)) ==
+          static_cast<ssize_t>(sizeof(values)) &&
+      values[2] > 0) {
+    return static_cast<double>(values[0]) * static_cast<double>(values[1]) /
+           static_cast<double>(values[2]);
+  }
+#endif
+  static_cast<void>(counter);
+  return -1.0;
+}
+
+}  // namespace omegazero
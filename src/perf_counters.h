@@ -0,0 +1,59 @@
+/* Noah Himed
+ *
+ * Define the PerfCounters type, a set of hardware performance counters read
+ * through the Linux perf_event_open() interface, used to explain changes in
+ * the speed of the benchmark and Perft. Counters the CPU or kernel doesn't
+ * support are reported as unavailable, and every counter is unavailable on
+ * other platforms.
+ *
+ * Licensed under MIT License. Terms and conditions enclosed in "LICENSE.txt".
+ */
+
+#ifndef OMEGAZERO_SRC_PERF_COUNTERS_H_
+#define OMEGAZERO_SRC_PERF_COUNTERS_H_
+
+#include <string>
+
+#include "move.h"
+
+namespace omegazero {
+
+enum PerfCounter {
+  kCycles,
+  kInstructions,
+  kL1DataMisses,
+  kLastLevelCacheMisses,
+  kBranchMisses,
+  kDataTlbMisses,
+  kNumPerfCounters,
+};
+
+class PerfCounters {
+ public:
+  // Open every counter, throwing runtime_error if none of them can be opened.
+  // The counters are opened disabled.
+  PerfCounters();
+  ~PerfCounters();
+  PerfCounters(const PerfCounters&) = delete;
+  auto operator=(const PerfCounters&) -> PerfCounters& = delete;
+
+  // Enable and disable counting of the calling thread. Counts accumulate
+  // over every Start() and Stop() pair, so that only the code in between is
+  // measured.
+  auto Start() -> void;
+  auto Stop() -> void;
+
+  // Output the total of each counter and its average per node.
+  auto Output(U64 num_nodes) const -> void;
+
+ private:
+  // Return the count of a counter, scaled up if the kernel multiplexed it
+  // with other counters, or -1 if it couldn't be opened or never ran.
+  auto Read(int counter) const -> double;
+
+  int fds_[kNumPerfCounters];
+};
+
+}  // namespace omegazero
+
+#endif  // OMEGAZERO_SRC_PERF_COUNTERS_H_
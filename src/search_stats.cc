@@ -0,0 +1,108 @@
+/* Noah Himed
+ *
+ * Implement the SearchStats type.
+ *
+ * Licensed under MIT License. Terms and conditions enclosed in "LICENSE.txt".
+ */
+
+#include "search_stats.h"
+
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+namespace omegazero {
+
+using std::fixed;
+using std::ostringstream;
+using std::setprecision;
+using std::string;
+
+namespace {
+
+// Compute a ratio, returning zero for an empty denominator.
+auto GetRatio(U64 numerator, U64 denominator) -> double {
+  if (denominator == 0) {
+    return 0.0;
+  }
+  return static_cast<double>(numerator) / static_cast<double>(denominator);
+}
+
+}  // namespace
+
+auto SearchStats::ToText(int depth, U64 prev_iteration_nodes) const -> string {
+  const char* kNodeTypeNames[kNumNodeTypes] = {"PV", "Cut", "All"};
+  ostringstream text;
+  text << fixed << setprecision(3);
+  text << "SEARCH STATS (DEPTH " << depth << ")\n";
+  text << "  Nodes: " << nodes << " (QSearch: " << qsearch_nodes << ")\n";
+  text << "  QSearch SEE prunes: " << see_prunes << "\n";
+  text << "  QSearch TT probes/cutoffs: " << qsearch_tt_probes << "/"
+       << qsearch_tt_cutoffs << "\n";
+  text << "  Tablebase hits: " << tablebase_hits << "\n";
+  text << "  Root passes: " << root_passes << "\n";
+  text << "  TT probes: " << tt_probes << "\n";
+  for (S8 node_type = 0; node_type < kNumNodeTypes; ++node_type) {
+    text << "  TT " << kNodeTypeNames[node_type]
+         << " hits/cutoffs: " << tt_hits[node_type] << "/"
+         << tt_cutoffs[node_type] << "\n";
+  }
+  text << "  Null moves/cutoffs: " << null_move_attempts << "/"
+       << null_move_cutoffs << "\n";
+  text << "  LMR reductions/re-searches: " << lmr_reductions << "/"
+       << lmr_researches << "\n";
+  text << "  Reverse futility prunes: " << reverse_futility_prunes << "\n";
+  text << "  Futility prunes: " << futility_prunes << "\n";
+  text << "  Razoring attempts/cutoffs: " << razoring_attempts << "/"
+       << razoring_cutoffs << "\n";
+  text << "  Late move prunes: " << late_move_prunes << "\n";
+  text << "  First move cutoff rate: "
+       << GetRatio(first_move_cutoffs, beta_cutoffs) << "\n";
+  text << "  Average moves searched: "
+       << GetRatio(moves_searched, expanded_nodes) << "\n";
+  text << "  Effective branching factor: "
+       << GetRatio(nodes, prev_iteration_nodes) << "\n";
+  text << "  Pawn table hit rate: "
+       << GetRatio(pawn_table_hits, pawn_table_probes) << "\n";
+  text << "  Eval cache hit rate: "
+       << GetRatio(eval_cache_hits, eval_cache_probes);
+  return text.str();
+}
+
+auto SearchStats::ToJson(int depth, U64 prev_iteration_nodes) const -> string {
+  ostringstream json;
+  json << fixed << setprecision(4);
+  json << "{\"depth\":" << depth << ",\"nodes\":" << nodes
+       << ",\"qsearch_nodes\":" << qsearch_nodes
+       << ",\"see_prunes\":" << see_prunes
+       << ",\"qsearch_tt_probes\":" << qsearch_tt_probes
+       << ",\"qsearch_tt_cutoffs\":" << qsearch_tt_cutoffs
+       << ",\"tablebase_hits\":" << tablebase_hits
+       << ",\"root_passes\":" << root_passes << ",\"tt_probes\":" << tt_probes
+       << ",\"tt_hits\":{\"pv\":" << tt_hits[0] << ",\"cut\":" << tt_hits[1]
+       << ",\"all\":" << tt_hits[2] << "}"
+       << ",\"tt_cutoffs\":{\"pv\":" << tt_cutoffs[0]
+       << ",\"cut\":" << tt_cutoffs[1] << ",\"all\":" << tt_cutoffs[2] << "}"
+       << ",\"null_move_attempts\":" << null_move_attempts
+       << ",\"null_move_cutoffs\":" << null_move_cutoffs
+       << ",\"lmr_reductions\":" << lmr_reductions
+       << ",\"lmr_researches\":" << lmr_researches
+       << ",\"reverse_futility_prunes\":" << reverse_futility_prunes
+       << ",\"futility_prunes\":" << futility_prunes
+       << ",\"razoring_attempts\":" << razoring_attempts
+       << ",\"razoring_cutoffs\":" << razoring_cutoffs
+       << ",\"late_move_prunes\":" << late_move_prunes
+       << ",\"beta_cutoffs\":" << beta_cutoffs
+       << ",\"first_move_cutoff_rate\":"
+       << GetRatio(first_move_cutoffs, beta_cutoffs)
+       << ",\"avg_moves_searched\":" << GetRatio(moves_searched, expanded_nodes)
+       << ",\"effective_branching_factor\":"
+       << GetRatio(nodes, prev_iteration_nodes)
+       << ",\"pawn_table_hit_rate\":"
+       << GetRatio(pawn_table_hits, pawn_table_probes)
+       << ",\"eval_cache_hit_rate\":"
+       << GetRatio(eval_cache_hits, eval_cache_probes) << "}";
+  return json.str();
+}
+
+}  // namespace omegazero
@@ -0,0 +1,101 @@
+/* Noah Himed
+ *
+ * Define the SearchStats type, a set of counters describing where effort is
+ * spent during a search. Counters are only updated in builds compiled with
+ * SEARCH_STATS defined, and are compiled out otherwise.
+ *
+ * Licensed under MIT License. Terms and conditions enclosed in "LICENSE.txt".
+ */
+
+#ifndef OMEGAZERO_SRC_SEARCH_STATS_H_
+#define OMEGAZERO_SRC_SEARCH_STATS_H_
+
+#include <string>
+
+#include "move.h"
+
+namespace omegazero {
+
+#ifdef SEARCH_STATS
+constexpr bool kSearchStatsEnabled = true;
+#else
+constexpr bool kSearchStatsEnabled = false;
+#endif
+
+enum StatsFormat : S8 {
+  kNoStats,
+  kTextStats,
+  kJsonStats,
+};
+
+// Store the number of node types a transposition table entry may have.
+constexpr S8 kNumNodeTypes = 3;
+
+struct SearchStats {
+  // Format the counters collected during one iteration of iterative deepening.
+  // The node count of the previous iteration is used to compute the effective
+  // branching factor.
+  auto ToText(int depth, U64 prev_iteration_nodes) const -> std::string;
+  auto ToJson(int depth, U64 prev_iteration_nodes) const -> std::string;
+
+  auto Clear() -> void { *this = SearchStats(); }
+
+  U64 nodes = 0;
+  U64 qsearch_nodes = 0;
+  // Count captures skipped in the quiescence search for losing material.
+  U64 see_prunes = 0;
+  // Count transposition table probes made by the quiescence search, and the
+  // cutoffs they produced.
+  U64 qsearch_tt_probes = 0;
+  U64 qsearch_tt_cutoffs = 0;
+  // Count the nodes whose evaluation was read from an endgame tablebase.
+  U64 tablebase_hits = 0;
+
+  // Count transposition table probes, and hits and cutoffs for each node type.
+  U64 tt_probes = 0;
+  U64 tt_hits[kNumNodeTypes] = {0, 0, 0};
+  U64 tt_cutoffs[kNumNodeTypes] = {0, 0, 0};
+
+  U64 null_move_attempts = 0;
+  U64 null_move_cutoffs = 0;
+
+  U64 lmr_reductions = 0;
+  U64 lmr_researches = 0;
+
+  // Count the nodes cut off by reverse futility pruning, the quiet moves
+  // skipped by futility pruning, the razoring searches made along with the
+  // cutoffs they produced, and the quiet moves skipped by late move pruning.
+  U64 reverse_futility_prunes = 0;
+  U64 futility_prunes = 0;
+  U64 razoring_attempts = 0;
+  U64 razoring_cutoffs = 0;
+  U64 late_move_prunes = 0;
+
+  // Count the number of null or aspiration window searches made at the root.
+  U64 root_passes = 0;
+
+  // Count the nodes that searched at least one move, the total number of legal
+  // moves searched at these nodes, and how many beta cutoffs they produced.
+  U64 expanded_nodes = 0;
+  U64 moves_searched = 0;
+  U64 beta_cutoffs = 0;
+  U64 first_move_cutoffs = 0;
+
+  U64 pawn_table_probes = 0;
+  U64 pawn_table_hits = 0;
+
+  U64 eval_cache_probes = 0;
+  U64 eval_cache_hits = 0;
+};
+
+// Increment a search statistic counter, doing nothing in builds without search
+// statistics.
+inline auto RecordStat(U64& counter) -> void {
+  if constexpr (kSearchStatsEnabled) {
+    ++counter;
+  }
+}
+
+}  // namespace omegazero
+
+#endif  // OMEGAZERO_SRC_SEARCH_STATS_H_
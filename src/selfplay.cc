@@ -0,0 +1,302 @@
+/* Noah Himed
+ *
+ * Implement the self-play match runner.
+ *
+ * Licensed under MIT License. Terms and conditions enclosed in "LICENSE.txt".
+ */
+
+#include "selfplay.h"
+
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "board.h"
+#include "engine.h"
+#include "game.h"
+#include "move.h"
+
+namespace omegazero {
+
+using std::atomic;
+using std::cout;
+using std::cref;
+using std::endl;
+using std::fixed;
+using std::invalid_argument;
+using std::isfinite;
+using std::lock_guard;
+using std::log;
+using std::log10;
+using std::mutex;
+using std::numeric_limits;
+using std::ostringstream;
+using std::pow;
+using std::ref;
+using std::setprecision;
+using std::sqrt;
+using std::string;
+using std::thread;
+using std::vector;
+
+namespace {
+
+const string kInitPos =
+    "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+
+// Store the results of a match from the engine's perspective.
+struct MatchScore {
+  int num_wins = 0;
+  int num_draws = 0;
+  int num_losses = 0;
+};
+
+struct SprtBounds {
+  double lower;
+  double upper;
+};
+
+auto GetNumGames(const MatchScore& match_score) -> int {
+  return match_score.num_wins + match_score.num_draws + match_score.num_losses;
+}
+
+// Compute the fraction of points scored, counting a draw as half a point.
+auto GetScoreFraction(const MatchScore& match_score) -> double {
+  return (match_score.num_wins + 0.5 * match_score.num_draws) /
+         GetNumGames(match_score);
+}
+
+// Compute the variance of the points scored in a single game.
+auto GetScoreVariance(const MatchScore& match_score) -> double {
+  double score = GetScoreFraction(match_score);
+  return (match_score.num_wins * pow(1.0 - score, 2.0) +
+          match_score.num_draws * pow(0.5 - score, 2.0) +
+          match_score.num_losses * pow(score, 2.0)) /
+         GetNumGames(match_score);
+}
+
+// Convert between an expected score and an Elo difference using the logistic
+// rating model.
+auto GetEloFromScore(double score) -> double {
+  if (score <= 0.0) {
+    return -numeric_limits<double>::infinity();
+  }
+  if (score >= 1.0) {
+    return numeric_limits<double>::infinity();
+  }
+  return -400.0 * log10(1.0 / score - 1.0);
+}
+
+auto GetScoreFromElo(double elo) -> double {
+  return 1.0 / (1.0 + pow(10.0, -elo / 400.0));
+}
+
+// Compute the half-width of the 95% confidence interval of the Elo difference.
+auto GetEloMargin(const MatchScore& match_score) -> double {
+  constexpr double kZScore95 = 1.959964;
+  double score = GetScoreFraction(match_score);
+  double score_margin =
+      kZScore95 * sqrt(GetScoreVariance(match_score) / GetNumGames(match_score));
+  return (GetEloFromScore(score + score_margin) -
+          GetEloFromScore(score - score_margin)) /
+         2.0;
+}
+
+// Compute the log-likelihood ratio of the alternative hypothesis (the engine is
+// elo1 stronger) to the null hypothesis (the engine is elo0 stronger), using the
+// normal approximation of the Generalized SPRT.
+auto GetLogLikelihoodRatio(const MatchScore& match_score, double elo0,
+                           double elo1) -> double {
+  if (GetNumGames(match_score) == 0) {
+    return 0.0;
+  }
+  double variance = GetScoreVariance(match_score);
+  if (variance == 0.0) {
+    return 0.0;
+  }
+  double score = GetScoreFraction(match_score);
+  double score0 = GetScoreFromElo(elo0);
+  double score1 = GetScoreFromElo(elo1);
+  return GetNumGames(match_score) * (score1 - score0) *
+         (2.0 * score - score0 - score1) / (2.0 * variance);
+}
+
+auto GetSprtBounds(const SelfplayOptions& selfplay_options) -> SprtBounds {
+  double alpha = selfplay_options.sprt_alpha;
+  double beta = selfplay_options.sprt_beta;
+  return {log(beta / (1.0 - alpha)), log((1.0 - beta) / alpha)};
+}
+
+auto FormatElo(double elo) -> string {
+  ostringstream elo_stream;
+  if (isfinite(elo)) {
+    elo_stream << fixed << setprecision(1) << elo;
+  } else {
+    elo_stream << (elo > 0.0 ? "+inf" : "-inf");
+  }
+  return elo_stream.str();
+}
+
+// Play a game from the initial position, returning the winner or kNA for a
+// draw. When sample_opening is set, up to kNumOpeningPlies book moves are
+// picked and stored in opening_moves. Otherwise the given opening moves are
+// replayed, so both games of a pair start from the same position.
+auto PlayGame(const string& opening_book_path, const EngineConfig& white_config,
+              const EngineConfig& black_config, bool sample_opening,
+              vector<Move>& opening_moves) -> S8 {
+  Game white_game(kInitPos, opening_book_path, 'b', white_config.search_time,
+                  sample_opening, white_config.search_options);
+  constexpr bool kNoOpeningBook = false;
+  Game black_game(kInitPos, opening_book_path, 'w', black_config.search_time,
+                  kNoOpeningBook, black_config.search_options);
+
+  for (size_t ply = 0;; ++ply) {
+    Move opening_move;
+    if (sample_opening) {
+      if (ply == kNumOpeningPlies || !white_game.GetOpeningMove(opening_move)) {
+        break;
+      }
+      opening_moves.push_back(opening_move);
+    } else {
+      if (ply == opening_moves.size()) {
+        break;
+      }
+      opening_move = opening_moves[ply];
+    }
+    white_game.MakeOtherEngineMove(opening_move);
+    black_game.MakeOtherEngineMove(opening_move);
+  }
+
+  // Alternate engine moves until the engine to move finds the game is over.
+  Game* games[kNumPlayers] = {&white_game, &black_game};
+  S8 player_to_move = (opening_moves.size() % 2 == 0) ? kWhite : kBlack;
+  while (true) {
+    Game& moving_game = *games[player_to_move];
+    Move engine_move = moving_game.MakeEngineMove();
+    if (!moving_game.IsActive()) {
+      return moving_game.GetWinner();
+    }
+    player_to_move = GetOtherPlayer(player_to_move);
+    games[player_to_move]->MakeOtherEngineMove(engine_move);
+  }
+}
+
+// Play game pairs until the match is over, taking the next unplayed pair from
+// the shared index each time. The engine plays White in the first game of a
+// pair and Black in the second.
+auto PlayGamePairs(const SelfplayOptions& selfplay_options,
+                   const EngineConfig& engine_config,
+                   const EngineConfig& opponent_config,
+                   atomic<int>& next_pair_idx, atomic<bool>& sprt_finished,
+                   MatchScore& match_score, mutex& score_mutex) -> void {
+  int num_games = selfplay_options.num_games;
+  SprtBounds sprt_bounds = GetSprtBounds(selfplay_options);
+  for (int pair_idx = next_pair_idx++; 2 * pair_idx < num_games;
+       pair_idx = next_pair_idx++) {
+    vector<Move> opening_moves;
+    for (int game_idx = 2 * pair_idx;
+         game_idx < num_games && game_idx <= 2 * pair_idx + 1; ++game_idx) {
+      if (sprt_finished) {
+        return;
+      }
+      bool engine_plays_white = (game_idx % 2 == 0);
+      S8 engine_player = engine_plays_white ? kWhite : kBlack;
+      S8 winner = PlayGame(
+          selfplay_options.opening_book_path,
+          engine_plays_white ? engine_config : opponent_config,
+          engine_plays_white ? opponent_config : engine_config,
+          engine_plays_white, opening_moves);
+
+      lock_guard<mutex> score_lock(score_mutex);
+      string result_str;
+      if (winner == kNA) {
+        ++match_score.num_draws;
+        result_str = "1/2-1/2";
+      } else {
+        ++(winner == engine_player ? match_score.num_wins
+                                   : match_score.num_losses);
+        result_str = (winner == kWhite) ? "1-0" : "0-1";
+      }
+      double llr = GetLogLikelihoodRatio(match_score, selfplay_options.sprt_elo0,
+                                         selfplay_options.sprt_elo1);
+      if (llr <= sprt_bounds.lower || llr >= sprt_bounds.upper) {
+        sprt_finished = true;
+      }
+      cout << "Game " << game_idx + 1 << " of " << num_games << " (engine as "
+           << GetPlayerStr(engine_player) << "): " << result_str
+           << " | Score: " << match_score.num_wins << " - "
+           << match_score.num_losses << " - " << match_score.num_draws
+           << " | LLR: " << fixed << setprecision(2) << llr << " ("
+           << sprt_bounds.lower << ", " << sprt_bounds.upper << ")" << endl;
+    }
+  }
+}
+
+}  // namespace
+
+auto RunSelfplay(const SelfplayOptions& selfplay_options,
+                 const EngineConfig& engine_config,
+                 const EngineConfig& opponent_config) -> void {
+  if (selfplay_options.num_games < 1) {
+    throw invalid_argument("Number of games must be at least one");
+  }
+  if (selfplay_options.num_threads < 1) {
+    throw invalid_argument("Number of threads must be at least one");
+  }
+  if (selfplay_options.sprt_elo0 >= selfplay_options.sprt_elo1) {
+    throw invalid_argument("SPRT elo0 must be less than elo1");
+  }
+
+  atomic<int> next_pair_idx(0);
+  atomic<bool> sprt_finished(false);
+  MatchScore match_score;
+  mutex score_mutex;
+  vector<thread> workers;
+  workers.reserve(selfplay_options.num_threads);
+  for (int thread_idx = 0; thread_idx < selfplay_options.num_threads;
+       ++thread_idx) {
+    workers.emplace_back(PlayGamePairs, cref(selfplay_options),
+                         cref(engine_config), cref(opponent_config),
+                         ref(next_pair_idx), ref(sprt_finished),
+                         ref(match_score), ref(score_mutex));
+  }
+  for (thread& worker : workers) {
+    worker.join();
+  }
+
+  // Summarize the match, with the score written as wins - losses - draws.
+  int num_games_played = GetNumGames(match_score);
+  double llr = GetLogLikelihoodRatio(match_score, selfplay_options.sprt_elo0,
+                                     selfplay_options.sprt_elo1);
+  SprtBounds sprt_bounds = GetSprtBounds(selfplay_options);
+  cout << "\nScore of engine vs opponent: " << match_score.num_wins << " - "
+       << match_score.num_losses << " - " << match_score.num_draws << " ["
+       << fixed << setprecision(3) << GetScoreFraction(match_score) << "] "
+       << num_games_played << endl;
+  cout << "Elo difference: "
+       << FormatElo(GetEloFromScore(GetScoreFraction(match_score))) << " +/- "
+       << FormatElo(GetEloMargin(match_score)) << endl;
+  cout << "SPRT: elo0 = " << setprecision(1) << selfplay_options.sprt_elo0
+       << ", elo1 = " << selfplay_options.sprt_elo1 << ", LLR = "
+       << setprecision(2) << llr << " (" << sprt_bounds.lower << ", "
+       << sprt_bounds.upper << "): ";
+  if (llr >= sprt_bounds.upper) {
+    cout << "H1 accepted" << endl;
+  } else if (llr <= sprt_bounds.lower) {
+    cout << "H0 accepted" << endl;
+  } else {
+    cout << "inconclusive" << endl;
+  }
+}
+
+}  // namespace omegazero
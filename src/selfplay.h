@@ -0,0 +1,52 @@
+/* Noah Himed
+ *
+ * Define a self-play match runner, which plays games between two engine
+ * configurations on a pool of worker threads and reports the match score with
+ * Elo and Sequential Probability Ratio Test (SPRT) statistics.
+ *
+ * Licensed under MIT License. Terms and conditions enclosed in "LICENSE.txt".
+ */
+
+#ifndef OMEGAZERO_SRC_SELFPLAY_H_
+#define OMEGAZERO_SRC_SELFPLAY_H_
+
+#include <string>
+
+#include "engine.h"
+
+namespace omegazero {
+
+// Store the number of plies played from the opening book at the start of each
+// game, if the book line is long enough.
+constexpr int kNumOpeningPlies = 8;
+
+// Store how an engine taking part in a match searches for each move.
+struct EngineConfig {
+  float search_time;
+  SearchOptions search_options;
+};
+
+struct SelfplayOptions {
+  int num_games = 0;
+  int num_threads = 1;
+  std::string opening_book_path;
+  // Store the Elo differences of the null (elo0) and alternative (elo1)
+  // hypotheses tested by the SPRT, and its false positive (alpha) and false
+  // negative (beta) rates.
+  double sprt_elo0 = 0.0;
+  double sprt_elo1 = 5.0;
+  double sprt_alpha = 0.05;
+  double sprt_beta = 0.05;
+};
+
+// Play games between an engine and an opponent, reporting results from the
+// engine's perspective. Each opening is sampled from the book and played twice
+// with colors reversed. No new games are started once the SPRT accepts either
+// hypothesis.
+auto RunSelfplay(const SelfplayOptions& selfplay_options,
+                 const EngineConfig& engine_config,
+                 const EngineConfig& opponent_config) -> void;
+
+}  // namespace omegazero
+
+#endif  // OMEGAZERO_SRC_SELFPLAY_H_
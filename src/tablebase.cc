@@ -0,0 +1,873 @@
+/* Noah Himed
+ *
+ * Implement the Tablebases type.
+ *
+ * Licensed under MIT License. Terms and conditions enclosed in "LICENSE.txt".
+ */
+
+#include "tablebase.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "board.h"
+#include "move.h"
+
+namespace omegazero {
+
+using std::copy;
+using std::count;
+using std::cout;
+using std::endl;
+using std::ios;
+using std::invalid_argument;
+using std::make_tuple;
+using std::max;
+using std::memcmp;
+using std::min;
+using std::ofstream;
+using std::runtime_error;
+using std::set;
+using std::sort;
+using std::string;
+using std::unique;
+using std::vector;
+using std::chrono::duration;
+using std::chrono::duration_cast;
+using std::chrono::high_resolution_clock;
+
+namespace {
+
+// Store the layout of a table file: a 16 byte header holding a magic string,
+// the format version, and the number of entries (all little-endian), followed
+// by one byte per entry.
+constexpr char kTablebaseMagic[] = "OZTB";
+constexpr U32 kTablebaseVersion = 1;
+constexpr size_t kTablebaseHeaderSize = 16;
+const string kTablebaseExtension = ".oztb";
+
+// Store how results are encoded in a table entry. Wins are stored as their
+// DTC, which is always positive, and losses as their DTC plus an offset.
+constexpr U8 kDrawEntry = 0;
+constexpr U8 kLossEntryOffset = 128;
+constexpr U8 kIllegalEntry = 255;
+constexpr int kMaxDtc = 126;
+
+// Store the number of squares the stronger side's king is restricted to by
+// symmetry. Tables with pawns may only be mirrored across the d and e files,
+// placing the king on files a-d. Tables without pawns may also be mirrored
+// across ranks and the a1-h8 diagonal, placing the king in the a1-d1-d4
+// triangle.
+constexpr int kNumPawnKingSqs = 32;
+constexpr int kNumPawnlessKingSqs = 10;
+constexpr S8 kPawnlessKingSqs[kNumPawnlessKingSqs] = {0, 1, 2, 3, 9, 10, 11,
+                                                      18, 19, 27};
+constexpr S8 kPawnlessKingSqIndices[kNumSq] = {
+    0,  1,  2,  3,  -1, -1, -1, -1, -1, 4,  5,  6,  -1, -1, -1, -1,
+    -1, -1, 7,  8,  -1, -1, -1, -1, -1, -1, -1, 9,  -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1};
+
+// Store the order pieces are listed in within a material signature (ex:
+// "KQvKR"), along with their letters. Piece order in array is pawn, knight,
+// bishop, rook, queen, king.
+constexpr S8 kSignaturePieceOrder[kNumPieceTypes] = {kKing, kQueen,  kRook,
+                                                     kBishop, kKnight, kPawn};
+constexpr char kPieceLetters[kNumPieceTypes] = {'P', 'N', 'B', 'R', 'Q', 'K'};
+constexpr S8 kPromotionPieces[] = {kQueen, kRook, kBishop, kKnight};
+
+auto GetPieceFromLetter(char piece_letter) -> S8 {
+  for (S8 piece = kPawn; piece <= kKing; ++piece) {
+    if (kPieceLetters[piece] == piece_letter) {
+      return piece;
+    }
+  }
+  throw invalid_argument("piece_letter in GetPieceFromLetter()");
+}
+
+auto MirrorFile(S8 sq) -> S8 { return sq ^ 7; }
+
+auto MirrorRank(S8 sq) -> S8 { return sq ^ 56; }
+
+auto Transpose(S8 sq) -> S8 {
+  return static_cast<S8>(((sq & 7) << 3) | (sq >> 3));
+}
+
+// Construct the pieces of one side in signature order (ex: "KRB").
+auto GetSideMaterial(const S8* piece_types, const S8* players, int num_pieces,
+                     S8 player) -> string {
+  string side_material;
+  for (S8 piece : kSignaturePieceOrder) {
+    for (int piece_idx = 0; piece_idx < num_pieces; ++piece_idx) {
+      if (players[piece_idx] == player && piece_types[piece_idx] == piece) {
+        side_material += kPieceLetters[piece];
+      }
+    }
+  }
+  return side_material;
+}
+
+auto GetMaterialVal(const string& side_material) -> int {
+  int material_val = 0;
+  for (char piece_letter : side_material) {
+    S8 piece = GetPieceFromLetter(piece_letter);
+    if (piece != kKing) {
+      material_val += kPieceVals[piece];
+    }
+  }
+  return material_val;
+}
+
+// Return if the second side should be listed first in a material signature,
+// so that the side with more material is always listed (and stored) first.
+auto SwapSides(const string& first_material, const string& second_material)
+    -> bool {
+  int first_val = GetMaterialVal(first_material);
+  int second_val = GetMaterialVal(second_material);
+  return second_val > first_val ||
+         (second_val == first_val && second_material > first_material);
+}
+
+// Compute the material signature of a position (ex: "KQvKR"), setting
+// swap_colors if Black is listed first.
+auto GetSignature(const TablebasePos& pos, bool& swap_colors) -> string {
+  string white_material = GetSideMaterial(pos.piece_types, pos.players,
+                                          pos.num_pieces, kWhite);
+  string black_material = GetSideMaterial(pos.piece_types, pos.players,
+                                          pos.num_pieces, kBlack);
+  swap_colors = SwapSides(white_material, black_material);
+  return swap_colors ? black_material + "v" + white_material
+                     : white_material + "v" + black_material;
+}
+
+auto AddPieceCombinations(int num_pieces, int first_piece_idx,
+                          const string& side_material,
+                          vector<string>& combinations) -> void {
+  if (num_pieces == 0) {
+    combinations.push_back(side_material);
+    return;
+  }
+  // Skip the king, which is listed first in kSignaturePieceOrder.
+  for (int piece_idx = first_piece_idx; piece_idx < kNumPieceTypes;
+       ++piece_idx) {
+    AddPieceCombinations(
+        num_pieces - 1, piece_idx,
+        side_material + kPieceLetters[kSignaturePieceOrder[piece_idx]],
+        combinations);
+  }
+}
+
+// List the material signature of every table with at most max_pieces pieces,
+// ordered so that each table comes after the tables its captures and
+// promotions lead to.
+auto GetSignatures(int max_pieces) -> vector<string> {
+  set<string> signatures;
+  for (int num_pieces = 3; num_pieces <= max_pieces; ++num_pieces) {
+    for (int num_first_pieces = 0; num_first_pieces <= num_pieces - 2;
+         ++num_first_pieces) {
+      vector<string> first_materials;
+      vector<string> second_materials;
+      AddPieceCombinations(num_first_pieces, 1, "K", first_materials);
+      AddPieceCombinations(num_pieces - 2 - num_first_pieces, 1, "K",
+                           second_materials);
+      for (const string& first_material : first_materials) {
+        for (const string& second_material : second_materials) {
+          signatures.insert(
+              SwapSides(first_material, second_material)
+                  ? second_material + "v" + first_material
+                  : first_material + "v" + second_material);
+        }
+      }
+    }
+  }
+
+  vector<string> ordered_signatures(signatures.begin(), signatures.end());
+  sort(ordered_signatures.begin(), ordered_signatures.end(),
+       [](const string& lhs, const string& rhs) {
+         return make_tuple(lhs.size(), count(lhs.begin(), lhs.end(), 'P'),
+                           lhs) < make_tuple(rhs.size(),
+                                             count(rhs.begin(), rhs.end(), 'P'),
+                                             rhs);
+       });
+  return ordered_signatures;
+}
+
+auto EncodeEntry(S8 wdl, int dtc) -> U8 {
+  if (wdl == kTablebaseWin) {
+    return static_cast<U8>(dtc);
+  }
+  if (wdl == kTablebaseLoss) {
+    return static_cast<U8>(kLossEntryOffset + dtc);
+  }
+  return kDrawEntry;
+}
+
+auto DecodeEntry(U8 entry) -> TablebaseResult {
+  if (entry == kDrawEntry) {
+    return {kTablebaseDraw, 0};
+  }
+  if (entry < kLossEntryOffset) {
+    return {kTablebaseWin, entry};
+  }
+  return {kTablebaseLoss, entry - kLossEntryOffset};
+}
+
+auto GetNumKingSqs(bool has_pawns) -> size_t {
+  return has_pawns ? kNumPawnKingSqs : kNumPawnlessKingSqs;
+}
+
+// Compute the index of a position whose pieces are ordered by slot, with the
+// first slot's king already moved into its symmetry region.
+auto GetRawTableIndex(const S8* sqs, int num_pieces, S8 player_to_move,
+                      bool has_pawns) -> size_t {
+  S8 king_sq = sqs[0];
+  size_t king_sq_idx =
+      has_pawns
+          ? GetRankFromSq(king_sq) * kNumFiles / 2 + GetFileFromSq(king_sq)
+          : kPawnlessKingSqIndices[king_sq];
+  size_t table_idx = player_to_move * GetNumKingSqs(has_pawns) + king_sq_idx;
+  for (int piece_idx = 1; piece_idx < num_pieces; ++piece_idx) {
+    table_idx = table_idx * kNumSq + sqs[piece_idx];
+  }
+  return table_idx;
+}
+
+// Compute the index of a position whose pieces are ordered by slot. Positions
+// that are symmetric to each other share an index: the one of the variant with
+// the first slot's king in its symmetry region, and the smallest index when the
+// king is on the a1-h8 diagonal.
+auto GetTableIndex(const TablebasePos& pos, bool has_pawns) -> size_t {
+  S8 sqs[kMaxTablebasePieces];
+  bool mirror_file = GetFileFromSq(pos.sqs[0]) > kFileD;
+  bool mirror_rank = !has_pawns && GetRankFromSq(pos.sqs[0]) > kRank4;
+  for (int piece_idx = 0; piece_idx < pos.num_pieces; ++piece_idx) {
+    S8 sq = pos.sqs[piece_idx];
+    sq = mirror_file ? MirrorFile(sq) : sq;
+    sqs[piece_idx] = mirror_rank ? MirrorRank(sq) : sq;
+  }
+  if (has_pawns) {
+    return GetRawTableIndex(sqs, pos.num_pieces, pos.player_to_move, true);
+  }
+
+  S8 king_rank = GetRankFromSq(sqs[0]);
+  S8 king_file = GetFileFromSq(sqs[0]);
+  if (king_rank > king_file) {
+    for (int piece_idx = 0; piece_idx < pos.num_pieces; ++piece_idx) {
+      sqs[piece_idx] = Transpose(sqs[piece_idx]);
+    }
+  }
+  size_t table_idx =
+      GetRawTableIndex(sqs, pos.num_pieces, pos.player_to_move, false);
+  if (king_rank == king_file) {
+    for (int piece_idx = 0; piece_idx < pos.num_pieces; ++piece_idx) {
+      sqs[piece_idx] = Transpose(sqs[piece_idx]);
+    }
+    table_idx = min(table_idx, GetRawTableIndex(sqs, pos.num_pieces,
+                                                pos.player_to_move, false));
+  }
+  return table_idx;
+}
+
+// Set the squares and player to move of a position from its raw index.
+auto DecodeTableIndex(size_t table_idx, bool has_pawns, TablebasePos& pos)
+    -> void {
+  for (int piece_idx = pos.num_pieces - 1; piece_idx > 0; --piece_idx) {
+    pos.sqs[piece_idx] = static_cast<S8>(table_idx % kNumSq);
+    table_idx /= kNumSq;
+  }
+  size_t num_king_sqs = GetNumKingSqs(has_pawns);
+  size_t king_sq_idx = table_idx % num_king_sqs;
+  pos.player_to_move = static_cast<S8>(table_idx / num_king_sqs);
+  pos.sqs[0] = has_pawns ? static_cast<S8>(king_sq_idx / (kNumFiles / 2) *
+                                               kNumFiles +
+                                           king_sq_idx % (kNumFiles / 2))
+                         : kPawnlessKingSqs[king_sq_idx];
+}
+
+auto GetOccupancy(const TablebasePos& pos) -> Bitboard {
+  Bitboard occupancy = 0X0;
+  for (int piece_idx = 0; piece_idx < pos.num_pieces; ++piece_idx) {
+    occupancy |= 1ULL << pos.sqs[piece_idx];
+  }
+  return occupancy;
+}
+
+auto GetKingSq(const TablebasePos& pos, S8 player) -> S8 {
+  for (int piece_idx = 0; piece_idx < pos.num_pieces; ++piece_idx) {
+    if (pos.players[piece_idx] == player &&
+        pos.piece_types[piece_idx] == kKing) {
+      return pos.sqs[piece_idx];
+    }
+  }
+  throw invalid_argument("pos in GetKingSq()");
+}
+
+// Return the squares a piece attacks. Pawns attack the squares they capture
+// on.
+auto GetPieceAttacks(S8 player, S8 piece, S8 sq, Bitboard occupancy)
+    -> Bitboard {
+  switch (piece) {
+    case kPawn:
+      return kNonSliderAttackMaps[(player == kWhite) ? kWhitePawnCapture
+                                                     : kBlackPawnCapture][sq];
+    case kKnight:
+      return kNonSliderAttackMaps[kKnightAttack][sq];
+    case kBishop:
+      return GetSliderAttackMap(sq, kBishopMoves, occupancy);
+    case kRook:
+      return GetSliderAttackMap(sq, kRookMoves, occupancy);
+    case kQueen:
+      return GetSliderAttackMap(sq, kBishopMoves, occupancy) |
+             GetSliderAttackMap(sq, kRookMoves, occupancy);
+    case kKing:
+      return kNonSliderAttackMaps[kKingAttack][sq];
+    default:
+      throw invalid_argument("piece in GetPieceAttacks()");
+  }
+}
+
+auto SqAttacked(const TablebasePos& pos, S8 sq, S8 attacking_player,
+                Bitboard occupancy) -> bool {
+  for (int piece_idx = 0; piece_idx < pos.num_pieces; ++piece_idx) {
+    if (pos.players[piece_idx] == attacking_player &&
+        (GetPieceAttacks(attacking_player, pos.piece_types[piece_idx],
+                         pos.sqs[piece_idx], occupancy) &
+         (1ULL << sq))) {
+      return true;
+    }
+  }
+  return false;
+}
+
+auto InCheck(const TablebasePos& pos) -> bool {
+  return SqAttacked(pos, GetKingSq(pos, pos.player_to_move),
+                    GetOtherPlayer(pos.player_to_move), GetOccupancy(pos));
+}
+
+// Return if no two pieces share a square, no pawns are on the first or last
+// rank, and the player who just moved isn't in check.
+auto IsLegalPos(const TablebasePos& pos) -> bool {
+  Bitboard occupancy = 0X0;
+  for (int piece_idx = 0; piece_idx < pos.num_pieces; ++piece_idx) {
+    Bitboard sq_mask = 1ULL << pos.sqs[piece_idx];
+    S8 rank = GetRankFromSq(pos.sqs[piece_idx]);
+    if ((occupancy & sq_mask) || (pos.piece_types[piece_idx] == kPawn &&
+                                  (rank == kRank1 || rank == kRank8))) {
+      return false;
+    }
+    occupancy |= sq_mask;
+  }
+  S8 moved_player = GetOtherPlayer(pos.player_to_move);
+  return !SqAttacked(pos, GetKingSq(pos, moved_player), pos.player_to_move,
+                     occupancy);
+}
+
+// Call visit(child, is_conversion) with the position after each legal move,
+// where conversions are captures and promotions. Note that tables ignore en
+// passant captures.
+template <typename Visitor>
+auto ForEachMove(const TablebasePos& pos, Visitor visit) -> void {
+  S8 moving_player = pos.player_to_move;
+  S8 enemy_player = GetOtherPlayer(moving_player);
+  Bitboard occupancy = GetOccupancy(pos);
+  Bitboard enemy_pieces = 0X0;
+  for (int piece_idx = 0; piece_idx < pos.num_pieces; ++piece_idx) {
+    if (pos.players[piece_idx] == enemy_player) {
+      enemy_pieces |= 1ULL << pos.sqs[piece_idx];
+    }
+  }
+
+  for (int piece_idx = 0; piece_idx < pos.num_pieces; ++piece_idx) {
+    if (pos.players[piece_idx] != moving_player) {
+      continue;
+    }
+    S8 start_sq = pos.sqs[piece_idx];
+    S8 piece = pos.piece_types[piece_idx];
+    Bitboard target_sqs;
+    if (piece == kPawn) {
+      target_sqs = GetPieceAttacks(moving_player, kPawn, start_sq, occupancy) &
+                   enemy_pieces;
+      S8 push_offset = (moving_player == kWhite) ? kNumFiles : -kNumFiles;
+      S8 start_rank = (moving_player == kWhite) ? kRank2 : kRank7;
+      Bitboard push_sq_mask = 1ULL << (start_sq + push_offset);
+      if (!(occupancy & push_sq_mask)) {
+        target_sqs |= push_sq_mask;
+        if (GetRankFromSq(start_sq) == start_rank &&
+            !(occupancy & (1ULL << (start_sq + 2 * push_offset)))) {
+          target_sqs |= 1ULL << (start_sq + 2 * push_offset);
+        }
+      }
+    } else {
+      target_sqs = GetPieceAttacks(moving_player, piece, start_sq, occupancy) &
+                   ~(occupancy & ~enemy_pieces);
+    }
+
+    while (target_sqs) {
+      S8 target_sq = GetSqOfFirstPiece(target_sqs);
+      RemoveFirstPiece(target_sqs);
+      TablebasePos child = pos;
+      child.player_to_move = enemy_player;
+      child.sqs[piece_idx] = target_sq;
+      int moved_piece_idx = piece_idx;
+      bool is_capture = static_cast<bool>(enemy_pieces & (1ULL << target_sq));
+      if (is_capture) {
+        // Remove the captured piece from the list.
+        int captured_piece_idx = 0;
+        while (pos.players[captured_piece_idx] != enemy_player ||
+               pos.sqs[captured_piece_idx] != target_sq) {
+          ++captured_piece_idx;
+        }
+        for (int shift_idx = captured_piece_idx;
+             shift_idx < child.num_pieces - 1; ++shift_idx) {
+          child.players[shift_idx] = child.players[shift_idx + 1];
+          child.piece_types[shift_idx] = child.piece_types[shift_idx + 1];
+          child.sqs[shift_idx] = child.sqs[shift_idx + 1];
+        }
+        --child.num_pieces;
+        if (captured_piece_idx < piece_idx) {
+          --moved_piece_idx;
+        }
+      }
+      if (SqAttacked(child, GetKingSq(child, moving_player), enemy_player,
+                     GetOccupancy(child))) {
+        continue;
+      }
+
+      S8 target_rank = GetRankFromSq(target_sq);
+      if (piece == kPawn && (target_rank == kRank1 || target_rank == kRank8)) {
+        for (S8 promoted_to_piece : kPromotionPieces) {
+          child.piece_types[moved_piece_idx] = promoted_to_piece;
+          visit(child, true);
+        }
+      } else {
+        visit(child, is_capture);
+      }
+    }
+  }
+}
+
+// Call visit(parent) with each legal position the player who just moved could
+// have moved from without capturing or promoting.
+template <typename Visitor>
+auto ForEachUnmove(const TablebasePos& pos, Visitor visit) -> void {
+  S8 moved_player = GetOtherPlayer(pos.player_to_move);
+  Bitboard occupancy = GetOccupancy(pos);
+  for (int piece_idx = 0; piece_idx < pos.num_pieces; ++piece_idx) {
+    if (pos.players[piece_idx] != moved_player) {
+      continue;
+    }
+    S8 target_sq = pos.sqs[piece_idx];
+    S8 piece = pos.piece_types[piece_idx];
+    Bitboard start_sqs = 0X0;
+    if (piece == kPawn) {
+      // Pawns move backwards by one square, or by two squares from the rank
+      // a double push lands on.
+      S8 push_offset = (moved_player == kWhite) ? kNumFiles : -kNumFiles;
+      S8 push_rank = (moved_player == kWhite) ? kRank3 : kRank6;
+      S8 double_push_rank = (moved_player == kWhite) ? kRank4 : kRank5;
+      S8 target_rank = GetRankFromSq(target_sq);
+      Bitboard push_start_sq_mask = 1ULL << (target_sq - push_offset);
+      bool push_start_sq_empty = !(occupancy & push_start_sq_mask);
+      if (((moved_player == kWhite) ? target_rank >= push_rank
+                                    : target_rank <= push_rank) &&
+          push_start_sq_empty) {
+        start_sqs |= push_start_sq_mask;
+      }
+      if (target_rank == double_push_rank && push_start_sq_empty &&
+          !(occupancy & (1ULL << (target_sq - 2 * push_offset)))) {
+        start_sqs |= 1ULL << (target_sq - 2 * push_offset);
+      }
+    } else {
+      start_sqs = GetPieceAttacks(moved_player, piece, target_sq, occupancy) &
+                  ~occupancy;
+    }
+
+    while (start_sqs) {
+      TablebasePos parent = pos;
+      parent.player_to_move = moved_player;
+      parent.sqs[piece_idx] = GetSqOfFirstPiece(start_sqs);
+      RemoveFirstPiece(start_sqs);
+      if (IsLegalPos(parent)) {
+        visit(parent);
+      }
+    }
+  }
+}
+
+auto WriteLittleEndian(ofstream& table_f, U64 val, size_t num_bytes) -> void {
+  for (size_t byte_idx = 0; byte_idx < num_bytes; ++byte_idx) {
+    table_f.put(static_cast<char>((val >> (8 * byte_idx)) & 0XFF));
+  }
+}
+
+auto ReadLittleEndian(const unsigned char* data, size_t num_bytes) -> U64 {
+  U64 val = 0;
+  for (size_t byte_idx = num_bytes; byte_idx > 0; --byte_idx) {
+    val = (val << 8) | data[byte_idx - 1];
+  }
+  return val;
+}
+
+}  // namespace
+
+Tablebases::Tablebases() { max_pieces_ = 0; }
+
+Tablebases::~Tablebases() {
+  for (auto& [signature, table] : tables_) {
+    munmap(const_cast<unsigned char*>(table.file_data), table.file_size);
+  }
+}
+
+auto Tablebases::Load(const string& tablebase_dir) -> int {
+  int num_tables_loaded = 0;
+  for (const string& signature : GetSignatures(kMaxTablebasePieces)) {
+    if (tables_.count(signature) == 0 &&
+        AddTable(signature,
+                 tablebase_dir + "/" + signature + kTablebaseExtension)) {
+      ++num_tables_loaded;
+    }
+  }
+  return num_tables_loaded;
+}
+
+auto Tablebases::Generate(const string& tablebase_dir, int max_pieces)
+    -> void {
+  if (max_pieces < 3 || max_pieces > kMaxTablebasePieces) {
+    throw invalid_argument("Tablebases can only be generated for 3 to " +
+                           std::to_string(kMaxTablebasePieces) + " pieces");
+  }
+  if (mkdir(tablebase_dir.c_str(), 0755) < 0 && errno != EEXIST) {
+    throw invalid_argument("Tablebase directory can't be created");
+  }
+
+  for (const string& signature : GetSignatures(max_pieces)) {
+    if (tables_.count(signature) == 0 &&
+        !AddTable(signature,
+                  tablebase_dir + "/" + signature + kTablebaseExtension)) {
+      GenerateTable(signature, tablebase_dir);
+    }
+  }
+}
+
+auto Tablebases::Probe(const Board& board, TablebaseResult& result) const
+    -> bool {
+  Bitboard all_pieces =
+      board.GetPiecesByType(kNA, kWhite) | board.GetPiecesByType(kNA, kBlack);
+  if (GetNumSetSq(all_pieces) > max_pieces_ || board.HasCastlingRights()) {
+    return false;
+  }
+  S8 player_to_move = board.GetPlayerToMove();
+  S8 ep_target_sq = board.GetEpTargetSq();
+  if (ep_target_sq != kNA) {
+    // Pawns that can capture en passant attack the target square as if they
+    // were pawns of the other player standing on it.
+    S8 capture_map_index =
+        (player_to_move == kWhite) ? kBlackPawnCapture : kWhitePawnCapture;
+    if (kNonSliderAttackMaps[capture_map_index][ep_target_sq] &
+        board.GetPiecesByType(kPawn, player_to_move)) {
+      return false;
+    }
+  }
+
+  TablebasePos pos;
+  pos.player_to_move = player_to_move;
+  while (all_pieces) {
+    S8 sq = GetSqOfFirstPiece(all_pieces);
+    RemoveFirstPiece(all_pieces);
+    pos.players[pos.num_pieces] = board.GetPlayerOnSq(sq);
+    pos.piece_types[pos.num_pieces] = board.GetPieceOnSq(sq);
+    pos.sqs[pos.num_pieces] = sq;
+    ++pos.num_pieces;
+  }
+  return ProbePos(pos, result);
+}
+
+// Implement private member functions.
+
+auto Tablebases::ParseSignature(const string& signature) -> Table {
+  Table table;
+  table.has_pawns = signature.find('P') != string::npos;
+  for (char piece_letter : signature) {
+    if (piece_letter == 'v') {
+      continue;
+    }
+    // Pieces listed before the "v" belong to the side stored as White.
+    table.slot_players.push_back(
+        table.slot_players.size() < signature.find('v') ? kWhite : kBlack);
+    table.slot_piece_types.push_back(GetPieceFromLetter(piece_letter));
+  }
+  table.num_entries = kNumPlayers * GetNumKingSqs(table.has_pawns);
+  for (size_t piece_idx = 1; piece_idx < table.slot_players.size();
+       ++piece_idx) {
+    table.num_entries *= kNumSq;
+  }
+  table.file_data = nullptr;
+  table.file_size = 0;
+  return table;
+}
+
+auto Tablebases::AddTable(const string& signature, const string& table_path)
+    -> bool {
+  int table_fd = open(table_path.c_str(), O_RDONLY);
+  if (table_fd < 0) {
+    return false;
+  }
+
+  Table table = ParseSignature(signature);
+  struct stat table_stat;
+  table.file_size = kTablebaseHeaderSize + table.num_entries;
+  if (fstat(table_fd, &table_stat) < 0 ||
+      static_cast<size_t>(table_stat.st_size) != table.file_size) {
+    close(table_fd);
+    throw invalid_argument("Tablebase " + table_path + " has the wrong size");
+  }
+  void* table_map =
+      mmap(nullptr, table.file_size, PROT_READ, MAP_PRIVATE, table_fd, 0);
+  // The mapping stays valid after the file descriptor is closed.
+  close(table_fd);
+  if (table_map == MAP_FAILED) {
+    throw invalid_argument("Tablebase " + table_path +
+                           " can't be memory mapped");
+  }
+  table.file_data = static_cast<const unsigned char*>(table_map);
+  if (memcmp(table.file_data, kTablebaseMagic, 4) != 0 ||
+      ReadLittleEndian(table.file_data + 4, 4) != kTablebaseVersion ||
+      ReadLittleEndian(table.file_data + 8, 8) != table.num_entries) {
+    munmap(table_map, table.file_size);
+    throw invalid_argument("Tablebase " + table_path +
+                           " is not a valid tablebase file");
+  }
+
+  tables_[signature] = table;
+  max_pieces_ =
+      max(max_pieces_, static_cast<int>(table.slot_piece_types.size()));
+  return true;
+}
+
+auto Tablebases::GenerateTable(const string& signature,
+                               const string& tablebase_dir) -> void {
+  high_resolution_clock::time_point generation_start =
+      high_resolution_clock::now();
+  Table table = ParseSignature(signature);
+  bool has_pawns = table.has_pawns;
+  size_t num_entries = table.num_entries;
+  TablebasePos pos;
+  pos.num_pieces = static_cast<int>(table.slot_players.size());
+  copy(table.slot_players.begin(), table.slot_players.end(), pos.players);
+  copy(table.slot_piece_types.begin(), table.slot_piece_types.end(),
+       pos.piece_types);
+
+  // Unresolved positions are draws once generation finishes. Positions are
+  // also resolved as draws as soon as they can't be won or lost.
+  vector<U8> entries(num_entries, kDrawEntry);
+  vector<bool> resolved(num_entries, false);
+  // Track positions that can convert into a draw, and so can't be lost.
+  vector<bool> draw_available(num_entries, false);
+  // Count the distinct positions in this table each position can move to
+  // whose results are still unknown.
+  vector<U8> num_unresolved_children(num_entries, 0);
+  // Store the positions resolved at each DTC, which are processed in order so
+  // that every position is resolved with its shortest win or longest loss.
+  vector<vector<U32>> resolved_positions(kMaxDtc + 2);
+  auto resolve = [&](size_t table_idx, S8 wdl, int dtc) {
+    if (dtc > kMaxDtc) {
+      throw runtime_error("tablebase DTC overflow in " + signature);
+    }
+    entries[table_idx] = EncodeEntry(wdl, dtc);
+    resolved[table_idx] = true;
+    resolved_positions[dtc].push_back(static_cast<U32>(table_idx));
+  };
+
+  // Resolve checkmates, stalemates, and positions decided by conversions into
+  // smaller tables.
+  vector<size_t> child_indices;
+  for (size_t table_idx = 0; table_idx < num_entries; ++table_idx) {
+    DecodeTableIndex(table_idx, has_pawns, pos);
+    if (!IsLegalPos(pos) || GetTableIndex(pos, has_pawns) != table_idx) {
+      entries[table_idx] = kIllegalEntry;
+      resolved[table_idx] = true;
+      continue;
+    }
+
+    child_indices.clear();
+    bool has_legal_moves = false;
+    bool conversion_wins = false;
+    ForEachMove(pos, [&](const TablebasePos& child, bool is_conversion) {
+      has_legal_moves = true;
+      if (!is_conversion) {
+        child_indices.push_back(GetTableIndex(child, has_pawns));
+        return;
+      }
+      TablebaseResult child_result;
+      if (!ProbePos(child, child_result)) {
+        throw runtime_error("missing tablebase for a conversion from " +
+                            signature);
+      }
+      if (child_result.wdl == kTablebaseLoss) {
+        conversion_wins = true;
+      } else if (child_result.wdl == kTablebaseDraw) {
+        draw_available[table_idx] = true;
+      }
+    });
+
+    sort(child_indices.begin(), child_indices.end());
+    child_indices.erase(unique(child_indices.begin(), child_indices.end()),
+                        child_indices.end());
+    if (conversion_wins) {
+      resolve(table_idx, kTablebaseWin, 1);
+    } else if (!has_legal_moves) {
+      if (InCheck(pos)) {
+        resolve(table_idx, kTablebaseLoss, 0);
+      } else {
+        resolved[table_idx] = true;
+      }
+    } else if (child_indices.empty()) {
+      if (draw_available[table_idx]) {
+        resolved[table_idx] = true;
+      } else {
+        resolve(table_idx, kTablebaseLoss, 1);
+      }
+    } else {
+      num_unresolved_children[table_idx] =
+          static_cast<U8>(child_indices.size());
+    }
+  }
+
+  // Work backwards from resolved positions: a position which can move to a
+  // lost position is won, and a position whose moves all lead to won
+  // positions is lost.
+  vector<size_t> parent_indices;
+  int max_dtc = 0;
+  for (int dtc = 0; dtc <= kMaxDtc; ++dtc) {
+    for (size_t resolved_idx = 0; resolved_idx < resolved_positions[dtc].size();
+         ++resolved_idx) {
+      size_t table_idx = resolved_positions[dtc][resolved_idx];
+      max_dtc = dtc;
+      DecodeTableIndex(table_idx, has_pawns, pos);
+      bool child_lost = entries[table_idx] >= kLossEntryOffset;
+
+      parent_indices.clear();
+      ForEachUnmove(pos, [&](const TablebasePos& parent) {
+        parent_indices.push_back(GetTableIndex(parent, has_pawns));
+      });
+      sort(parent_indices.begin(), parent_indices.end());
+      parent_indices.erase(
+          unique(parent_indices.begin(), parent_indices.end()),
+          parent_indices.end());
+      for (size_t parent_idx : parent_indices) {
+        if (resolved[parent_idx]) {
+          continue;
+        }
+        if (child_lost) {
+          resolve(parent_idx, kTablebaseWin, dtc + 1);
+        } else if (--num_unresolved_children[parent_idx] == 0) {
+          if (draw_available[parent_idx]) {
+            resolved[parent_idx] = true;
+          } else {
+            resolve(parent_idx, kTablebaseLoss, dtc + 1);
+          }
+        }
+      }
+    }
+  }
+
+  string table_path = tablebase_dir + "/" + signature + kTablebaseExtension;
+  ofstream table_f(table_path, ios::binary);
+  if (!table_f.is_open()) {
+    throw invalid_argument("Tablebase file can't be created");
+  }
+  table_f.write(kTablebaseMagic, 4);
+  WriteLittleEndian(table_f, kTablebaseVersion, 4);
+  WriteLittleEndian(table_f, num_entries, 8);
+  table_f.write(reinterpret_cast<const char*>(entries.data()),
+                static_cast<std::streamsize>(num_entries));
+  table_f.close();
+  AddTable(signature, table_path);
+
+  size_t num_wins = 0;
+  size_t num_losses = 0;
+  size_t num_illegal = 0;
+  for (U8 entry : entries) {
+    if (entry == kIllegalEntry) {
+      ++num_illegal;
+    } else if (entry >= kLossEntryOffset) {
+      ++num_losses;
+    } else if (entry != kDrawEntry) {
+      ++num_wins;
+    }
+  }
+  float generation_duration =
+      duration_cast<duration<float>>(high_resolution_clock::now() -
+                                     generation_start)
+          .count();
+  cout << signature << ": " << num_entries - num_illegal << " positions ("
+       << num_wins << " won, " << num_entries - num_illegal - num_wins -
+                                      num_losses
+       << " drawn, " << num_losses << " lost), longest DTC " << max_dtc
+       << " plies, generated in " << generation_duration << " s" << endl;
+}
+
+auto Tablebases::ProbePos(const TablebasePos& pos,
+                          TablebaseResult& result) const -> bool {
+  // Two bare kings can't win.
+  if (pos.num_pieces == 2) {
+    result = {kTablebaseDraw, 0};
+    return true;
+  }
+
+  bool swap_colors;
+  auto table_it = tables_.find(GetSignature(pos, swap_colors));
+  if (table_it == tables_.end()) {
+    return false;
+  }
+  const Table& table = table_it->second;
+
+  // Place each piece in the first free slot for its color and type, flipping
+  // the board vertically when the stronger side is Black.
+  TablebasePos table_pos;
+  table_pos.num_pieces = pos.num_pieces;
+  table_pos.player_to_move = swap_colors
+                                 ? GetOtherPlayer(pos.player_to_move)
+                                 : pos.player_to_move;
+  bool slot_filled[kMaxTablebasePieces] = {};
+  for (int piece_idx = 0; piece_idx < pos.num_pieces; ++piece_idx) {
+    S8 player = swap_colors ? GetOtherPlayer(pos.players[piece_idx])
+                            : pos.players[piece_idx];
+    int slot = 0;
+    while (slot_filled[slot] || table.slot_players[slot] != player ||
+           table.slot_piece_types[slot] != pos.piece_types[piece_idx]) {
+      ++slot;
+    }
+    slot_filled[slot] = true;
+    table_pos.players[slot] = player;
+    table_pos.piece_types[slot] = pos.piece_types[piece_idx];
+    table_pos.sqs[slot] = swap_colors ? MirrorRank(pos.sqs[piece_idx])
+                                      : pos.sqs[piece_idx];
+  }
+
+  U8 entry = table.file_data[kTablebaseHeaderSize +
+                             GetTableIndex(table_pos, table.has_pawns)];
+  if (entry == kIllegalEntry) {
+    return false;
+  }
+  result = DecodeEntry(entry);
+  return true;
+}
+
+}  // namespace omegazero
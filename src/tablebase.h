@@ -0,0 +1,117 @@
+/* Noah Himed
+ *
+ * Define the Tablebases type, a set of endgame tablebases for positions with
+ * few pieces. Tables are generated by retrograde analysis and store the exact
+ * result of every position along with its distance to conversion (DTC): the
+ * number of plies until mate, or until a capture or promotion that leaves the
+ * table without changing the result. Table files are memory mapped from disk.
+ *
+ * Licensed under MIT License. Terms and conditions enclosed in "LICENSE.txt".
+ */
+
+#ifndef OMEGAZERO_SRC_TABLEBASE_H_
+#define OMEGAZERO_SRC_TABLEBASE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "board.h"
+#include "move.h"
+
+namespace omegazero {
+
+using std::map;
+using std::string;
+using std::vector;
+
+typedef uint8_t U8;
+typedef uint32_t U32;
+
+// Store the largest number of pieces, including kings, that tables can be
+// generated for. Each extra piece multiplies the size of a table by 64.
+constexpr int kMaxTablebasePieces = 4;
+
+enum TablebaseWdl : S8 {
+  kTablebaseLoss = -1,
+  kTablebaseDraw,
+  kTablebaseWin,
+};
+
+// Store the result of a position relative to the player to move.
+struct TablebaseResult {
+  S8 wdl;
+  // Store the number of plies until mate or a conversion with best play.
+  int dtc;
+};
+
+// Store a position as a list of pieces, which is faster to enumerate and
+// modify during generation than a Board.
+struct TablebasePos {
+  int num_pieces = 0;
+  S8 players[kMaxTablebasePieces];
+  S8 piece_types[kMaxTablebasePieces];
+  S8 sqs[kMaxTablebasePieces];
+  S8 player_to_move;
+};
+
+class Tablebases {
+ public:
+  Tablebases();
+  ~Tablebases();
+
+  Tablebases(const Tablebases&) = delete;
+  auto operator=(const Tablebases&) -> Tablebases& = delete;
+
+  // Memory map every table found in a directory, returning the number of
+  // tables loaded.
+  auto Load(const string& tablebase_dir) -> int;
+  // Generate the tables of every material combination with at most max_pieces
+  // pieces that aren't in the directory yet, writing them to the directory and
+  // loading them. Tables are generated after the smaller tables they convert
+  // into.
+  auto Generate(const string& tablebase_dir, int max_pieces) -> void;
+
+  // Look up the result of the position on the board. Return false if no table
+  // covers the position, or if castling or an en passant capture is possible
+  // (tables assume neither is).
+  auto Probe(const Board& board, TablebaseResult& result) const -> bool;
+  // Return the largest number of pieces covered by a loaded table.
+  auto GetMaxPieces() const -> int;
+
+ private:
+  struct Table {
+    // Store the color and type of the piece in each slot of an index, with
+    // the stronger side's king first and its pieces playing White.
+    vector<S8> slot_players;
+    vector<S8> slot_piece_types;
+    bool has_pawns;
+    size_t num_entries;
+    // Store the memory mapped file, whose entries follow the header.
+    const unsigned char* file_data;
+    size_t file_size;
+  };
+
+  // Set up the slots and number of entries of a table from its material
+  // signature (ex: "KQvKR").
+  static auto ParseSignature(const string& signature) -> Table;
+
+  auto AddTable(const string& signature, const string& table_path) -> bool;
+  auto GenerateTable(const string& signature, const string& tablebase_dir)
+      -> void;
+  auto ProbePos(const TablebasePos& pos, TablebaseResult& result) const
+      -> bool;
+
+  map<string, Table> tables_;
+  int max_pieces_;
+};
+
+// Implement public inline member functions.
+
+inline auto Tablebases::GetMaxPieces() const -> int { return max_pieces_; }
+
+}  // namespace omegazero
+
+#endif  // OMEGAZERO_SRC_TABLEBASE_H_
@@ -7,18 +7,40 @@
 
 #include "transposition_table.h"
 
+#include <stdexcept>
+
 #include "board.h"
 #include "move.h"
 
 namespace omegazero {
 
-constexpr U64 kHashMask = 0X7FFFF;
+using std::invalid_argument;
+
+TranspositionTable::TranspositionTable(int size_mb) {
+  if (size_mb < 1) {
+    throw invalid_argument("Hash size must be at least 1 MB");
+  }
+
+  // Each slot holds a depth preferred and an always replace entry.
+  constexpr U64 kSlotSize = 2 * sizeof(TableEntry);
+  U64 max_num_slots = (static_cast<U64>(size_mb) << 20) / kSlotSize;
+  U64 num_slots = 1;
+  while (2 * num_slots <= max_num_slots) {
+    num_slots *= 2;
+  }
+  hash_mask_ = num_slots - 1;
+  always_replace_entries_.resize(num_slots);
+  depth_pref_entries_.resize(num_slots);
+  // Start at a generation newer than that of the default constructed entries,
+  // so that all slots are unoccupied.
+  generation_ = 1;
+}
 
 auto TranspositionTable::Access(const Board* board, int depth, int& eval,
                                 S8& node_type) const -> bool {
   U64 board_hash = board->GetBoardHash();
-  int index = board_hash & kHashMask;
-  if (occupancy_table_[index]) {
+  U64 index = board_hash & hash_mask_;
+  if (depth_pref_entries_[index].generation == generation_) {
     TableEntry table_entry = depth_pref_entries_[index];
     // Check that the current node is to be searched at a lower depth than the
     // stored evaluation was assessed for.
@@ -43,20 +65,22 @@ auto TranspositionTable::Access(const Board* board, int depth, int& eval,
 
 auto TranspositionTable::PosIsPvNode(const Board* board) const -> bool {
   U64 board_hash = board->GetBoardHash();
-  int index = board_hash & kHashMask;
-  if (occupancy_table_[index]) {
+  U64 index = board_hash & hash_mask_;
+  if (depth_pref_entries_[index].generation == generation_) {
     TableEntry table_entry = depth_pref_entries_[index];
 
     // Check the "depth preferred" table first.
     if (table_entry.board_hash == board_hash) {
-      return table_entry.node_type == kPvNode;
+      return table_entry.node_type == kPvNode &&
+             table_entry.search_depth > kQuiescenceDepth;
     }
 
     // Check the "always replace" table if a collision was detected in the
     // "depth preferred" table.
     table_entry = always_replace_entries_[index];
     if (table_entry.board_hash == board_hash) {
-      return table_entry.node_type == kPvNode;
+      return table_entry.node_type == kPvNode &&
+             table_entry.search_depth > kQuiescenceDepth;
     }
   }
   return false;
@@ -64,9 +88,9 @@ auto TranspositionTable::PosIsPvNode(const Board* board) const -> bool {
 
 auto TranspositionTable::GetHashMove(const Board* board) const -> Move {
   U64 board_hash = board->GetBoardHash();
-  int index = board_hash & kHashMask;
+  U64 index = board_hash & hash_mask_;
   Move hash_move;
-  if (occupancy_table_[index]) {
+  if (depth_pref_entries_[index].generation == generation_) {
     TableEntry table_entry = depth_pref_entries_[index];
     // Check the "depth preferred" table first.
     if (table_entry.board_hash == board_hash) {
@@ -92,20 +116,24 @@ auto TranspositionTable::Update(const Board* board, int depth, int eval,
   new_entry.search_depth = depth;
   new_entry.eval = eval;
   new_entry.node_type = node_type;
+  new_entry.generation = generation_;
 
-  int index = board_hash & kHashMask;
-  if (occupancy_table_[index]) {
+  U64 index = board_hash & hash_mask_;
+  if (depth_pref_entries_[index].generation == generation_) {
     if (new_entry.search_depth > depth_pref_entries_[index].search_depth) {
       // Overwrite the depth preferred entry if the new position is evaluated
       // with deeper depth than the depth of the depth preferred entry.
       depth_pref_entries_[index] = new_entry;
-    } else {
+    } else if (new_entry.search_depth > kQuiescenceDepth ||
+               always_replace_entries_[index].search_depth <=
+                   kQuiescenceDepth) {
+      // Keep quiescence search results from replacing main search results,
+      // which take far longer to find.
       always_replace_entries_[index] = new_entry;
     }
   } else {
     always_replace_entries_[index] = new_entry;
     depth_pref_entries_[index] = new_entry;
-    occupancy_table_[index] = true;
   }
 }
 
@@ -10,6 +10,7 @@
 #define OMEGAZERO_SRC_TRANSPOSITION_TABLE_H
 
 #include <algorithm>
+#include <cstdint>
 #include <cstring>
 #include <stdexcept>
 #include <vector>
@@ -22,17 +23,21 @@ namespace omegazero {
 using std::begin;
 using std::copy;
 using std::end;
-using std::fill;
 using std::vector;
 
+typedef uint32_t U32;
+
 enum NodeType : S8 {
   kPvNode,
   kCutNode,
   kAllNode,
 };
 
-// Store a mask with least significant 19 bits set for computing table indices.
-constexpr int kTableSize = 1 << 20;
+constexpr int kDefaultHashSizeMb = 64;
+
+// Store the depth the quiescence search stores its results with, so that they
+// may only be used by the quiescence search and the leaves of the main search.
+constexpr int kQuiescenceDepth = 0;
 
 struct TableEntry {
   Move hash_move;
@@ -40,18 +45,25 @@ struct TableEntry {
   int eval;
   int search_depth;
   S8 node_type;
+  // Store the generation of the table the entry was stored in. Entries from
+  // before the table was last cleared are treated as empty.
+  U32 generation = 0;
 };
 
 class TranspositionTable {
  public:
-  TranspositionTable();
+  // Allocate a table with the largest power of two number of slots fitting in
+  // the given number of megabytes. Throw invalid_argument if the size is less
+  // than one megabyte.
+  explicit TranspositionTable(int size_mb = kDefaultHashSizeMb);
 
   // Loop up the board position in the hash table and set eval to the
   // corresponding evaluation if the position is found. Return a bool to
   // indicate if the position was found.
   auto Access(const Board* board, int depth, int& eval, S8& node_type) const
       -> bool;
-  // Return if the given board position has been stored as a PV node.
+  // Return if the given board position has been stored as a PV node by the
+  // main search.
   auto PosIsPvNode(const Board* board) const -> bool;
 
   auto GetHashMove(const Board* board) const -> Move;
@@ -61,21 +73,22 @@ class TranspositionTable {
   auto Update(const Board* board, int depth, int eval, S8 node_type) -> void;
   auto Clear() -> void;
 
+  // Start loading the entries of a position into the cache, so that the miss
+  // latency overlaps with other work done before the position is looked up.
+  auto Prefetch(U64 board_hash) const -> void;
+
  private:
-  // Store which slots in the table are occupied.
-  vector<bool> occupancy_table_;
+  // Store a mask of the low bits of a board hash which index the table.
+  U64 hash_mask_;
+  // Store the generation of the table, which is advanced when the table is
+  // cleared. A slot is occupied if its entries are of the current generation,
+  // so that checking it reads the same cache lines as the entries themselves.
+  U32 generation_;
 
   vector<TableEntry> always_replace_entries_;
   vector<TableEntry> depth_pref_entries_;
 };
 
-inline TranspositionTable::TranspositionTable() {
-  always_replace_entries_.reserve(kTableSize);
-  depth_pref_entries_.reserve(kTableSize);
-  occupancy_table_.reserve(kTableSize);
-  // Initialize all slots intable_entry the occupancy table to unoccupied.
-  Clear();
-}
 
 inline auto TranspositionTable::Update(const Board* board, int depth, int eval,
                                        S8 node_type) -> void {
@@ -83,8 +96,12 @@ inline auto TranspositionTable::Update(const Board* board, int depth, int eval,
   Update(board, depth, eval, node_type, throwaway_move);
 }
 
-inline auto TranspositionTable::Clear() -> void {
-  fill(occupancy_table_.begin(), occupancy_table_.end(), false);
+inline auto TranspositionTable::Clear() -> void { ++generation_; }
+
+inline auto TranspositionTable::Prefetch(U64 board_hash) const -> void {
+  U64 index = board_hash & hash_mask_;
+  __builtin_prefetch(&depth_pref_entries_[index]);
+  __builtin_prefetch(&always_replace_entries_[index]);
 }
 
 }  // namespace omegazero
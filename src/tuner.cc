@@ -0,0 +1,741 @@
+/* Noah Himed
+ *
+ * Implement the Texel style evaluation tuner.
+ *
+ * Licensed under MIT License. Terms and conditions enclosed in "LICENSE.txt".
+ */
+
+#include "tuner.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "bad_move.h"
+#include "board.h"
+#include "engine.h"
+#include "eval_params.h"
+#include "move.h"
+
+namespace omegazero {
+
+using std::abs;
+using std::atomic;
+using std::cout;
+using std::cref;
+using std::endl;
+using std::exception;
+using std::fill;
+using std::ifstream;
+using std::invalid_argument;
+using std::istringstream;
+using std::log;
+using std::lround;
+using std::max;
+using std::min;
+using std::ostringstream;
+using std::pow;
+using std::ref;
+using std::remove_if;
+using std::runtime_error;
+using std::sqrt;
+using std::string;
+using std::thread;
+using std::to_string;
+using std::vector;
+using std::chrono::duration;
+using std::chrono::duration_cast;
+using std::chrono::high_resolution_clock;
+
+typedef uint16_t U16;
+typedef int16_t S16;
+typedef uint32_t U32;
+
+namespace {
+
+// Index the tuned weights. The value of the king isn't tuned, since both
+// players always have one.
+constexpr int kPieceValParamsIdx = 0;
+constexpr int kPieceSqParamsIdx = kPieceValParamsIdx + kNumPieceTypes - 1;
+constexpr int kEndgameKingParamsIdx =
+    kPieceSqParamsIdx + kNumPieceTypes * kNumSq;
+constexpr int kBishopPairParamIdx = kEndgameKingParamsIdx + kNumSq;
+constexpr int kConnectedRookParamIdx = kBishopPairParamIdx + 1;
+constexpr int kCastlingRightsLossParamIdx = kConnectedRookParamIdx + 1;
+constexpr int kBackwardPawnParamIdx = kCastlingRightsLossParamIdx + 1;
+constexpr int kDoubledPawnParamIdx = kBackwardPawnParamIdx + 1;
+constexpr int kIsolatedPawnParamIdx = kDoubledPawnParamIdx + 1;
+constexpr int kNeighborParamIdx = kIsolatedPawnParamIdx + 1;
+constexpr int kDefenderParamIdx = kNeighborParamIdx + 1;
+constexpr int kRookBehindPassedPawnParamIdx = kDefenderParamIdx + 1;
+constexpr int kPassedPawnParamsIdx = kRookBehindPassedPawnParamIdx + 1;
+constexpr int kKingPawnShieldHoleParamIdx = kPassedPawnParamsIdx + kNumRanks;
+constexpr int kNumTunerParams = kKingPawnShieldHoleParamIdx + 1;
+
+constexpr int kMiddlegameKingParamsIdx = kPieceSqParamsIdx + kKing * kNumSq;
+
+// Store the number of lines loaded by each worker thread at a time.
+constexpr size_t kLoadChunkSize = 4096;
+
+// Store a weight's coefficient in the evaluation of a position, which counts
+// the times a term applies to White minus the times it applies to Black.
+struct TunerTerm {
+  U16 param_idx;
+  S16 coef;
+};
+
+// Store a position as the range of its nonzero terms in a shared array, along
+// with the game phase used to taper the king's position terms.
+struct TunerPos {
+  U32 first_term_idx;
+  U16 num_terms;
+  U16 phase;
+  float result = 0.0f;
+};
+
+struct TunerDataset {
+  vector<TunerPos> positions;
+  vector<TunerTerm> terms;
+  size_t num_skipped_lines = 0;
+  size_t num_mismatched_evals = 0;
+};
+
+// Parse a labelled position into a FEN string and game result, returning false
+// for blank lines. Only the first four FEN fields are read, since the move
+// counters don't affect the evaluation.
+auto ParseTunerLine(const string& line, string& fen, float& result) -> bool {
+  istringstream line_stream(line);
+  constexpr int kNumFenFields = 4;
+  string field;
+  fen.clear();
+  for (int field_idx = 0; field_idx < kNumFenFields; ++field_idx) {
+    if (!(line_stream >> field)) {
+      if (field_idx == 0) {
+        return false;
+      }
+      throw invalid_argument("labelled position \"" + line + "\"");
+    }
+    fen += (field_idx == 0) ? field : " " + field;
+  }
+  fen += " 0 1";
+
+  // Take the last result found among the remaining fields, ignoring the
+  // brackets, quotes, and semicolons around it.
+  bool found_result = false;
+  while (line_stream >> field) {
+    field.erase(remove_if(field.begin(), field.end(),
+                          [](char ch) {
+                            return ch == '[' || ch == ']' || ch == '"' ||
+                                   ch == ';';
+                          }),
+                field.end());
+    if (field == "1.0" || field == "1-0") {
+      result = 1.0f;
+    } else if (field == "0.5" || field == "1/2-1/2") {
+      result = 0.5f;
+    } else if (field == "0.0" || field == "0-1") {
+      result = 0.0f;
+    } else {
+      continue;
+    }
+    found_result = true;
+  }
+  if (!found_result) {
+    throw invalid_argument("labelled position \"" + line + "\"");
+  }
+  return true;
+}
+
+// Search the captures of the board's position, storing the line of captures
+// that leads to the quiet position whose evaluation is returned.
+auto QuiescenceSearch(Engine& engine, Board& board, int alpha, int beta,
+                      vector<Move>& pv) -> int {
+  pv.clear();
+  int stand_pat = board.Evaluate();
+  if (stand_pat >= beta) {
+    return stand_pat;
+  }
+  alpha = max(alpha, stand_pat);
+
+  constexpr bool kCapturesOnly = true;
+  vector<Move> child_pv;
+  for (const Move& move : engine.GenerateMoves(kCapturesOnly)) {
+    // Skip captures that lose material, as the engine's search does.
+    if (board.StaticExchangeEval(move) < 0) {
+      continue;
+    }
+    try {
+      board.MakeMove(move);
+    } catch (BadMove& e) {
+      continue;
+    }
+    int eval = -QuiescenceSearch(engine, board, -beta, -alpha, child_pv);
+    board.UnmakeMove(move);
+    if (eval > alpha) {
+      alpha = eval;
+      pv.assign(1, move);
+      pv.insert(pv.end(), child_pv.begin(), child_pv.end());
+      if (alpha >= beta) {
+        break;
+      }
+    }
+  }
+  return alpha;
+}
+
+// Add the pawn structure terms of one player's pawns to the coefficients. This
+// mirrors Board::EvaluatePawnStructure().
+auto AddPawnStructureTerms(const Board& board, S8 player,
+                           Bitboard enemy_attack_map, Bitboard attackspan,
+                           Bitboard defender_map, int* coefs) -> void {
+  S8 player_side = (player == kWhite) ? 1 : -1;
+  Bitboard pawns = board.GetPiecesByType(kPawn, player);
+  for (S8 file = kFileA; file <= kFileH; ++file) {
+    Bitboard pawns_on_file = pawns & kFileMasks[file];
+    if (!static_cast<bool>(pawns_on_file)) {
+      continue;
+    }
+    if (MultipleSetSq(pawns_on_file)) {
+      coefs[kDoubledPawnParamIdx] -= player_side;
+      continue;
+    }
+    S8 pawn_sq = GetSqOfFirstPiece(pawns_on_file);
+    if (!static_cast<bool>(kPawnFrontSpanMasks[player][pawn_sq] &
+                           board.GetPiecesByType(kPawn,
+                                                 GetOtherPlayer(player)))) {
+      coefs[kPassedPawnParamsIdx + GetRankFromSq(pawn_sq)] += player_side;
+      if (static_cast<bool>(board.GetPiecesByType(kRook, player) &
+                            kFileMasks[file])) {
+        coefs[kRookBehindPassedPawnParamIdx] += player_side;
+      }
+    } else {
+      Bitboard neighbor_files = 0X0;
+      if (file != kFileA) {
+        neighbor_files |= kFileMasks[file - 1];
+      }
+      if (file != kFileH) {
+        neighbor_files |= kFileMasks[file + 1];
+      }
+      if (!static_cast<bool>(neighbor_files & pawns)) {
+        coefs[kIsolatedPawnParamIdx] -= player_side;
+      }
+    }
+  }
+
+  Bitboard backward_pawns =
+      (player == kWhite)
+          ? ((pawns << kNumFiles) & enemy_attack_map & ~attackspan) >>
+                kNumFiles
+          : ((pawns >> kNumFiles) & enemy_attack_map & ~attackspan)
+                << kNumFiles;
+  coefs[kBackwardPawnParamIdx] -= player_side * GetNumSetSq(backward_pawns);
+  Bitboard pawns_with_east_neighbor =
+      (pawns >> 1) & pawns & ~kFileMasks[kFileH];
+  coefs[kNeighborParamIdx] +=
+      player_side * GetNumSetSq(pawns_with_east_neighbor);
+  coefs[kDefenderParamIdx] += player_side * GetNumSetSq(pawns & defender_map);
+
+  S8 king_sq = GetSqOfFirstPiece(board.GetPiecesByType(kKing, player));
+  S8 king_rank = GetRankFromSq(king_sq);
+  S8 king_file = GetFileFromSq(king_sq);
+  if (king_file == kFileD || king_rank == kFileE) {
+    return;
+  }
+  S8 pawn_shield_dir;
+  if (player == kWhite && (king_rank == kRank1 || king_rank == kRank2)) {
+    pawn_shield_dir = 1;
+  } else if (player == kBlack && (king_rank == kRank7 || king_rank == kRank8)) {
+    pawn_shield_dir = -1;
+  } else {
+    return;
+  }
+  for (S8 file_offset = -1; file_offset <= 1; ++file_offset) {
+    S8 shield_file = king_file + file_offset;
+    if (!FileOnBoard(shield_file)) {
+      continue;
+    }
+    S8 shield_sq = GetSqFromRankFile(king_rank + pawn_shield_dir, shield_file);
+    if (board.GetPlayerOnSq(shield_sq) != player ||
+        board.GetPieceOnSq(shield_sq) != kPawn) {
+      coefs[kKingPawnShieldHoleParamIdx] -= player_side;
+    }
+  }
+}
+
+// Compute the coefficient of each weight in the evaluation of a position, from
+// White's perspective, along with its game phase. This mirrors
+// Board::Evaluate().
+auto GetEvalTerms(const Board& board, int* coefs, int& phase) -> void {
+  fill(coefs, coefs + kNumTunerParams, 0);
+  phase = kTotalPhase;
+  for (S8 player = kWhite; player <= kBlack; ++player) {
+    for (S8 piece = kPawn; piece <= kQueen; ++piece) {
+      phase -= GetNumSetSq(board.GetPiecesByType(piece, player)) *
+               kPiecePhases[piece];
+    }
+  }
+  phase = (phase * kPhaseNorm + (kTotalPhase / 2)) / kTotalPhase;
+
+  Bitboard attackspans[kNumPlayers] = {0X0, 0X0};
+  Bitboard attack_maps[kNumPlayers] = {0X0, 0X0};
+  Bitboard defender_maps[kNumPlayers] = {0X0, 0X0};
+  for (S8 sq = kSqA1; sq <= kSqH8; ++sq) {
+    S8 piece_type = board.GetPieceOnSq(sq);
+    if (piece_type == kNA) {
+      continue;
+    }
+    S8 player = board.GetPlayerOnSq(sq);
+    S8 player_side = (player == kWhite) ? 1 : -1;
+    S8 table_sq = (player == kWhite) ? sq
+                                     : GetSqFromRankFile(
+                                           kRank8 - GetRankFromSq(sq),
+                                           GetFileFromSq(sq));
+    coefs[kPieceSqParamsIdx + piece_type * kNumSq + table_sq] += player_side;
+    if (piece_type == kKing) {
+      coefs[kEndgameKingParamsIdx + table_sq] += player_side;
+    } else {
+      coefs[kPieceValParamsIdx + piece_type] += player_side;
+    }
+
+    if (piece_type == kPawn) {
+      S8 other_player = GetOtherPlayer(player);
+      attackspans[player] |= kPawnFrontAttackspanMasks[player][sq];
+      attack_maps[player] |=
+          kNonSliderAttackMaps[(player == kWhite) ? kWhitePawnCapture
+                                                  : kBlackPawnCapture][sq];
+      defender_maps[player] |=
+          kNonSliderAttackMaps[(other_player == kWhite) ? kWhitePawnCapture
+                                                        : kBlackPawnCapture]
+                              [sq];
+    }
+  }
+
+  for (S8 player = kWhite; player <= kBlack; ++player) {
+    AddPawnStructureTerms(board, player, attack_maps[GetOtherPlayer(player)],
+                          attackspans[player], defender_maps[player], coefs);
+
+    S8 player_side = (player == kWhite) ? 1 : -1;
+    if (GetNumSetSq(board.GetPiecesByType(kBishop, player)) >= 2) {
+      coefs[kBishopPairParamIdx] += player_side;
+    }
+    Bitboard rooks = board.GetPiecesByType(kRook, player);
+    if (GetNumSetSq(rooks) >= 2 &&
+        static_cast<bool>(
+            board.GetAttackMap(player, GetSqOfFirstPiece(rooks), kRook) &
+            rooks)) {
+      coefs[kConnectedRookParamIdx] += player_side;
+    }
+    if (!board.HasCastled(player)) {
+      for (S8 board_side = kQueenSide; board_side <= kKingSide; ++board_side) {
+        if (!board.GetCastlingRight(player, board_side)) {
+          coefs[kCastlingRightsLossParamIdx] -= player_side;
+        }
+      }
+    }
+  }
+}
+
+// Convert evaluation weights to a flat vector of tuner parameters.
+auto GetTunerParams(const EvalParams& eval_params) -> vector<double> {
+  vector<double> params(kNumTunerParams);
+  for (S8 piece = kPawn; piece <= kQueen; ++piece) {
+    params[kPieceValParamsIdx + piece] = eval_params.piece_vals[piece];
+  }
+  for (S8 piece = kPawn; piece <= kKing; ++piece) {
+    for (S8 sq = kSqA1; sq <= kSqH8; ++sq) {
+      params[kPieceSqParamsIdx + piece * kNumSq + sq] =
+          eval_params.piece_sq_tables[piece][sq];
+    }
+  }
+  for (S8 sq = kSqA1; sq <= kSqH8; ++sq) {
+    params[kEndgameKingParamsIdx + sq] =
+        eval_params.endgame_king_piece_sq_table[sq];
+  }
+  params[kBishopPairParamIdx] = eval_params.bishop_pair_bonus;
+  params[kConnectedRookParamIdx] = eval_params.connected_rook_bonus;
+  params[kCastlingRightsLossParamIdx] =
+      eval_params.castling_rights_loss_penalty;
+  params[kBackwardPawnParamIdx] = eval_params.backward_pawn_penalty;
+  params[kDoubledPawnParamIdx] = eval_params.doubled_pawn_penalty;
+  params[kIsolatedPawnParamIdx] = eval_params.isolated_pawn_penalty;
+  params[kNeighborParamIdx] = eval_params.neighbor_bonus;
+  params[kDefenderParamIdx] = eval_params.defender_bonus;
+  params[kRookBehindPassedPawnParamIdx] =
+      eval_params.rook_behind_passed_pawn_bonus;
+  for (S8 rank = kRank1; rank <= kRank8; ++rank) {
+    params[kPassedPawnParamsIdx + rank] =
+        eval_params.passed_pawn_bonuses[rank];
+  }
+  params[kKingPawnShieldHoleParamIdx] =
+      eval_params.king_pawn_shield_hole_penalty;
+  return params;
+}
+
+// Round tuner parameters to evaluation weights. The king's value isn't tuned,
+// so it's copied from the given weights.
+auto GetEvalParams(const vector<double>& params,
+                   const EvalParams& initial_params) -> EvalParams {
+  EvalParams eval_params = initial_params;
+  for (S8 piece = kPawn; piece <= kQueen; ++piece) {
+    eval_params.piece_vals[piece] = lround(params[kPieceValParamsIdx + piece]);
+  }
+  for (S8 piece = kPawn; piece <= kKing; ++piece) {
+    for (S8 sq = kSqA1; sq <= kSqH8; ++sq) {
+      eval_params.piece_sq_tables[piece][sq] =
+          lround(params[kPieceSqParamsIdx + piece * kNumSq + sq]);
+    }
+  }
+  for (S8 sq = kSqA1; sq <= kSqH8; ++sq) {
+    eval_params.endgame_king_piece_sq_table[sq] =
+        lround(params[kEndgameKingParamsIdx + sq]);
+  }
+  eval_params.bishop_pair_bonus = lround(params[kBishopPairParamIdx]);
+  eval_params.connected_rook_bonus = lround(params[kConnectedRookParamIdx]);
+  eval_params.castling_rights_loss_penalty =
+      lround(params[kCastlingRightsLossParamIdx]);
+  eval_params.backward_pawn_penalty = lround(params[kBackwardPawnParamIdx]);
+  eval_params.doubled_pawn_penalty = lround(params[kDoubledPawnParamIdx]);
+  eval_params.isolated_pawn_penalty = lround(params[kIsolatedPawnParamIdx]);
+  eval_params.neighbor_bonus = lround(params[kNeighborParamIdx]);
+  eval_params.defender_bonus = lround(params[kDefenderParamIdx]);
+  eval_params.rook_behind_passed_pawn_bonus =
+      lround(params[kRookBehindPassedPawnParamIdx]);
+  for (S8 rank = kRank1; rank <= kRank8; ++rank) {
+    eval_params.passed_pawn_bonuses[rank] =
+        lround(params[kPassedPawnParamsIdx + rank]);
+  }
+  eval_params.king_pawn_shield_hole_penalty =
+      lround(params[kKingPawnShieldHoleParamIdx]);
+  return eval_params;
+}
+
+// Return the factor a weight is scaled by in a position of the given phase.
+// King position weights are tapered between the middlegame and endgame tables.
+auto GetTaper(int param_idx, int phase) -> double {
+  if (param_idx >= kMiddlegameKingParamsIdx &&
+      param_idx < kMiddlegameKingParamsIdx + kNumSq) {
+    return static_cast<double>(kPhaseNorm - phase) / kPhaseNorm;
+  }
+  if (param_idx >= kEndgameKingParamsIdx &&
+      param_idx < kEndgameKingParamsIdx + kNumSq) {
+    return static_cast<double>(phase) / kPhaseNorm;
+  }
+  return 1.0;
+}
+
+auto GetLinearEval(const TunerPos& pos, const TunerTerm* terms,
+                   const vector<double>& params) -> double {
+  double eval = 0.0;
+  for (const TunerTerm* term = terms + pos.first_term_idx;
+       term != terms + pos.first_term_idx + pos.num_terms; ++term) {
+    eval += term->coef * params[term->param_idx] *
+            GetTaper(term->param_idx, pos.phase);
+  }
+  return eval;
+}
+
+auto GetWinProbability(double eval, double k) -> double {
+  return 1.0 / (1.0 + pow(10.0, -k * eval / 400.0));
+}
+
+// Convert the labelled positions of lines until none are left, taking the next
+// chunk of lines from the shared index each time. Each position is stored as
+// the terms of the quiet position at the end of its quiescence search.
+auto LoadPositions(const vector<string>& lines, atomic<size_t>& next_line_idx,
+                   const EvalParams& initial_params, TunerDataset& dataset)
+    -> void {
+  Board board("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
+  SearchOptions search_options;
+  search_options.verbose = false;
+  search_options.eval_params = &initial_params;
+  Engine engine(&board, 'w', 1.0f, search_options);
+  vector<double> initial_tuner_params = GetTunerParams(initial_params);
+  vector<Move> pv;
+  int coefs[kNumTunerParams];
+  string fen;
+  float result = 0.0f;
+  size_t num_lines = lines.size();
+  for (size_t chunk_idx = next_line_idx.fetch_add(kLoadChunkSize);
+       chunk_idx < num_lines;
+       chunk_idx = next_line_idx.fetch_add(kLoadChunkSize)) {
+    size_t last_line_idx = min(chunk_idx + kLoadChunkSize, num_lines);
+    for (size_t line_idx = chunk_idx; line_idx < last_line_idx; ++line_idx) {
+      try {
+        if (!ParseTunerLine(lines[line_idx], fen, result)) {
+          continue;
+        }
+        board.SetPos(fen);
+      } catch (exception& e) {
+        ++dataset.num_skipped_lines;
+        continue;
+      }
+      // Skip positions in check, where standing pat isn't allowed.
+      if (board.KingInCheck()) {
+        ++dataset.num_skipped_lines;
+        continue;
+      }
+
+      QuiescenceSearch(engine, board, kWorstEval, kBestEval, pv);
+      for (const Move& move : pv) {
+        board.MakeMove(move);
+      }
+      int phase;
+      GetEvalTerms(board, coefs, phase);
+      TunerPos pos;
+      pos.first_term_idx = static_cast<U32>(dataset.terms.size());
+      pos.phase = static_cast<U16>(phase);
+      pos.result = result;
+      for (int param_idx = 0; param_idx < kNumTunerParams; ++param_idx) {
+        if (coefs[param_idx] != 0) {
+          dataset.terms.push_back({static_cast<U16>(param_idx),
+                                   static_cast<S16>(coefs[param_idx])});
+        }
+      }
+      pos.num_terms =
+          static_cast<U16>(dataset.terms.size() - pos.first_term_idx);
+
+      // Check that the terms reproduce the evaluation, up to the rounding of
+      // the tapered king position terms. The pawn table is cleared first,
+      // since its entries are keyed by the pawns alone and may hold the king
+      // shelter and rook terms of another position with the same pawns, and
+      // so is the evaluation cache, which may hold an evaluation made with
+      // such an entry.
+      board.ClearPawnTable();
+      board.ClearEvalCache();
+      S8 moving_side = (board.GetPlayerToMove() == kWhite) ? 1 : -1;
+      double eval_error =
+          GetLinearEval(pos, dataset.terms.data(), initial_tuner_params) -
+          moving_side * board.Evaluate();
+      if (abs(eval_error) >= 2.0) {
+        ++dataset.num_mismatched_evals;
+      }
+      dataset.positions.push_back(pos);
+
+      for (auto move = pv.rbegin(); move != pv.rend(); ++move) {
+        board.UnmakeMove(*move);
+      }
+    }
+  }
+}
+
+// Add the squared error of positions in [first_pos_idx, last_pos_idx) to the
+// error, and its gradient with respect to each weight to the gradient if it
+// isn't null.
+auto AddError(const TunerDataset& dataset, const vector<double>& params,
+              double k, size_t first_pos_idx, size_t last_pos_idx,
+              double& error, vector<double>* gradient) -> void {
+  const TunerTerm* terms = dataset.terms.data();
+  // Store the derivative of the win probability's exponent with respect to the
+  // evaluation.
+  double exponent_derivative = k * log(10.0) / 400.0;
+  for (size_t pos_idx = first_pos_idx; pos_idx < last_pos_idx; ++pos_idx) {
+    const TunerPos& pos = dataset.positions[pos_idx];
+    double win_probability =
+        GetWinProbability(GetLinearEval(pos, terms, params), k);
+    double residual = pos.result - win_probability;
+    error += residual * residual;
+    if (gradient == nullptr) {
+      continue;
+    }
+    double eval_gradient = -2.0 * residual * win_probability *
+                           (1.0 - win_probability) * exponent_derivative;
+    for (const TunerTerm* term = terms + pos.first_term_idx;
+         term != terms + pos.first_term_idx + pos.num_terms; ++term) {
+      (*gradient)[term->param_idx] +=
+          eval_gradient * term->coef * GetTaper(term->param_idx, pos.phase);
+    }
+  }
+}
+
+// Compute the mean squared error over the dataset, and its gradient if it
+// isn't null, splitting the positions evenly across the threads.
+auto ComputeError(const TunerDataset& dataset, const vector<double>& params,
+                  double k, int num_threads, vector<double>* gradient)
+    -> double {
+  size_t num_positions = dataset.positions.size();
+  vector<double> thread_errors(num_threads, 0.0);
+  vector<vector<double>> thread_gradients(
+      num_threads, vector<double>(gradient ? kNumTunerParams : 0, 0.0));
+  vector<thread> workers;
+  workers.reserve(num_threads);
+  for (int thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+    size_t first_pos_idx = num_positions * thread_idx / num_threads;
+    size_t last_pos_idx = num_positions * (thread_idx + 1) / num_threads;
+    workers.emplace_back(AddError, cref(dataset), cref(params), k,
+                         first_pos_idx, last_pos_idx,
+                         ref(thread_errors[thread_idx]),
+                         gradient ? &thread_gradients[thread_idx] : nullptr);
+  }
+  for (thread& worker : workers) {
+    worker.join();
+  }
+
+  double error = 0.0;
+  for (int thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+    error += thread_errors[thread_idx];
+    if (gradient != nullptr) {
+      for (int param_idx = 0; param_idx < kNumTunerParams; ++param_idx) {
+        (*gradient)[param_idx] +=
+            thread_gradients[thread_idx][param_idx] / num_positions;
+      }
+    }
+  }
+  return error / num_positions;
+}
+
+// Find the scaling constant K of the win probability that minimizes the error
+// of the current weights using a golden section search.
+auto FindBestK(const TunerDataset& dataset, const vector<double>& params,
+               int num_threads) -> double {
+  constexpr double kMinK = 0.0;
+  constexpr double kMaxK = 5.0;
+  constexpr double kTolerance = 1e-4;
+  const double kInvGoldenRatio = (sqrt(5.0) - 1.0) / 2.0;
+  double low_k = kMinK;
+  double high_k = kMaxK;
+  while (high_k - low_k > kTolerance) {
+    double left_k = high_k - kInvGoldenRatio * (high_k - low_k);
+    double right_k = low_k + kInvGoldenRatio * (high_k - low_k);
+    if (ComputeError(dataset, params, left_k, num_threads, nullptr) <
+        ComputeError(dataset, params, right_k, num_threads, nullptr)) {
+      high_k = right_k;
+    } else {
+      low_k = left_k;
+    }
+  }
+  return (low_k + high_k) / 2.0;
+}
+
+}  // namespace
+
+auto RunTexelTuning(const TunerOptions& tuner_options) -> void {
+  int num_threads = tuner_options.num_threads;
+  if (num_threads < 1) {
+    throw invalid_argument("Number of threads must be at least one");
+  }
+  if (tuner_options.num_epochs < 0) {
+    throw invalid_argument("Number of tuning epochs can't be negative");
+  }
+
+  ifstream dataset_f(tuner_options.dataset_path);
+  if (!dataset_f.is_open()) {
+    throw invalid_argument("Tuner dataset file can't be opened");
+  }
+  vector<string> lines;
+  string line;
+  while (getline(dataset_f, line)) {
+    lines.push_back(line);
+  }
+  dataset_f.close();
+
+  // Load the positions on every thread, then merge each thread's positions.
+  high_resolution_clock::time_point load_start = high_resolution_clock::now();
+  atomic<size_t> next_line_idx(0);
+  vector<TunerDataset> thread_datasets(num_threads);
+  vector<thread> workers;
+  workers.reserve(num_threads);
+  for (int thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+    workers.emplace_back(LoadPositions, cref(lines), ref(next_line_idx),
+                         cref(tuner_options.initial_params),
+                         ref(thread_datasets[thread_idx]));
+  }
+  for (thread& worker : workers) {
+    worker.join();
+  }
+  vector<string>().swap(lines);
+  TunerDataset dataset;
+  for (TunerDataset& thread_dataset : thread_datasets) {
+    U32 term_offset = static_cast<U32>(dataset.terms.size());
+    for (TunerPos pos : thread_dataset.positions) {
+      pos.first_term_idx += term_offset;
+      dataset.positions.push_back(pos);
+    }
+    dataset.terms.insert(dataset.terms.end(), thread_dataset.terms.begin(),
+                         thread_dataset.terms.end());
+    dataset.num_skipped_lines += thread_dataset.num_skipped_lines;
+    dataset.num_mismatched_evals += thread_dataset.num_mismatched_evals;
+    thread_dataset = TunerDataset();
+  }
+  if (dataset.num_mismatched_evals > 0) {
+    throw runtime_error("tuner terms, which don't match Board::Evaluate() in " +
+                        to_string(dataset.num_mismatched_evals) +
+                        " positions");
+  }
+  if (dataset.positions.empty()) {
+    throw invalid_argument("Tuner dataset has no usable positions");
+  }
+  float load_duration = duration_cast<duration<float>>(
+                            high_resolution_clock::now() - load_start)
+                            .count();
+  cout << "Loaded " << dataset.positions.size() << " positions ("
+       << dataset.terms.size() << " terms, " << dataset.num_skipped_lines
+       << " lines skipped) in " << load_duration << " s" << endl;
+
+  vector<double> params = GetTunerParams(tuner_options.initial_params);
+  double k = FindBestK(dataset, params, num_threads);
+  double initial_error = ComputeError(dataset, params, k, num_threads, nullptr);
+  cout << "K: " << k << ", initial error: " << initial_error << endl;
+
+  // Minimize the error with the Adam optimizer, which scales each weight's
+  // step by the running size of its gradient, so that rarely used piece square
+  // table weights move as quickly as material weights.
+  constexpr double kBeta1 = 0.9;
+  constexpr double kBeta2 = 0.999;
+  constexpr double kEpsilon = 1e-8;
+  constexpr int kReportInterval = 25;
+  vector<double> momentum(kNumTunerParams, 0.0);
+  vector<double> velocity(kNumTunerParams, 0.0);
+  vector<double> gradient(kNumTunerParams);
+  high_resolution_clock::time_point tune_start = high_resolution_clock::now();
+  double error = initial_error;
+  for (int epoch = 1; epoch <= tuner_options.num_epochs; ++epoch) {
+    fill(gradient.begin(), gradient.end(), 0.0);
+    error = ComputeError(dataset, params, k, num_threads, &gradient);
+    double momentum_correction = 1.0 - pow(kBeta1, epoch);
+    double velocity_correction = 1.0 - pow(kBeta2, epoch);
+    for (int param_idx = 0; param_idx < kNumTunerParams; ++param_idx) {
+      momentum[param_idx] =
+          kBeta1 * momentum[param_idx] + (1.0 - kBeta1) * gradient[param_idx];
+      velocity[param_idx] =
+          kBeta2 * velocity[param_idx] +
+          (1.0 - kBeta2) * gradient[param_idx] * gradient[param_idx];
+      params[param_idx] -=
+          tuner_options.learning_rate *
+          (momentum[param_idx] / momentum_correction) /
+          (sqrt(velocity[param_idx] / velocity_correction) + kEpsilon);
+    }
+    if (epoch % kReportInterval == 0) {
+      cout << "Epoch " << epoch << ": error " << error << endl;
+    }
+  }
+  double final_error = ComputeError(dataset, params, k, num_threads, nullptr);
+  float tune_duration = duration_cast<duration<float>>(
+                            high_resolution_clock::now() - tune_start)
+                            .count();
+  cout << "Final error: " << final_error << " after "
+       << tuner_options.num_epochs << " epochs in " << tune_duration << " s"
+       << endl;
+
+  ostringstream comment;
+  comment << "Tuned on " << dataset.positions.size() << " positions with K = "
+          << k << ".\nMean squared error: " << initial_error << " -> "
+          << final_error;
+  WriteEvalParams(tuner_options.output_path,
+                  GetEvalParams(params, tuner_options.initial_params),
+                  comment.str());
+  cout << "Wrote tuned weights to " << tuner_options.output_path << endl;
+}
+
+}  // namespace omegazero
@@ -0,0 +1,45 @@
+/* Noah Himed
+ *
+ * Define a Texel style tuner, which fits the weights of the evaluation function
+ * to the results of the games a set of positions were taken from.
+ *
+ * Licensed under MIT License. Terms and conditions enclosed in "LICENSE.txt".
+ */
+
+#ifndef OMEGAZERO_SRC_TUNER_H_
+#define OMEGAZERO_SRC_TUNER_H_
+
+#include <string>
+
+#include "eval_params.h"
+
+namespace omegazero {
+
+struct TunerOptions {
+  // Store the path of a file of labelled positions, one per line, each written
+  // as a FEN string or EPD record followed by the game result from White's
+  // perspective (ex: "[1.0]", "[0.5]", "0-1", or c9 "1/2-1/2";).
+  std::string dataset_path;
+  // Store the path the tuned weights are written to, in the format read by
+  // LoadEvalParams().
+  std::string output_path;
+  // Store the weights tuning starts from.
+  EvalParams initial_params = kDefaultEvalParams;
+  int num_threads = 1;
+  int num_epochs = 500;
+  // Store the largest change to a weight per epoch, in centipawns.
+  double learning_rate = 1.0;
+};
+
+// Tune the evaluation weights to minimize the mean squared error between each
+// game result and the win probability predicted by the evaluation of the quiet
+// position at the end of the quiescence search of its position. The loaded
+// positions are stored as their evaluation terms, since the evaluation is
+// linear in its weights, and the error and its gradient are computed using the
+// given number of threads. The tuned weights are written as an evaluation
+// parameter file, which can be loaded with "--eval-params".
+auto RunTexelTuning(const TunerOptions& tuner_options) -> void;
+
+}  // namespace omegazero
+
+#endif  // OMEGAZERO_SRC_TUNER_H_